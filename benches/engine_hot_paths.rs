@@ -0,0 +1,218 @@
+// =============================================================================
+// REACTOR Benchmarks — Engine Hot Paths
+// =============================================================================
+// Criterion suite for the paths that dominate frame time. Run with
+// `cargo bench` and compare across commits with `cargo bench -- --save-baseline`.
+//
+// Groups:
+//   - frustum_culling:   Frustum::intersects_aabb over a 10k-object scene
+//   - ecs_query:         World::query iteration over 10k entities
+//   - particle_update:   CPU ParticleSystem::update with 10k live particles
+//   - linear_allocator:  LinearAllocator::allocate bump-path throughput
+//   - animation_sample:  AnimationTrack::sample keyframe lookup + lerp
+//   - asset_db:          AssetDatabase::get_metadata (memory-cache hit path)
+//   - gltf_load:         full glTF load of the checked-in test model
+// =============================================================================
+
+use std::collections::HashMap;
+
+use criterion::{black_box, criterion_group, criterion_main, Criterion};
+use glam::{Mat4, Quat, Vec3};
+
+use reactor_vulkan::core::linear_allocator::LinearAllocator;
+use reactor_vulkan::resources::asset_id::AssetId;
+use reactor_vulkan::resources::{AssetDatabase, AssetMetadata, AssetType};
+use reactor_vulkan::scene::World;
+use reactor_vulkan::systems::animation::{AnimationTrack, LoopMode};
+use reactor_vulkan::systems::particles::{ParticleSystem, ParticleSystemConfig, RandomRange};
+use reactor_vulkan::systems::physics::AABB;
+use reactor_vulkan::systems::Frustum;
+
+/// Deterministic LCG so scenes are identical across runs and commits.
+fn lcg(state: &mut u64) -> f32 {
+    *state = state.wrapping_mul(6364136223846793005).wrapping_add(1442695040888963407);
+    ((*state >> 33) as u32 as f32) / (u32::MAX as f32)
+}
+
+fn bench_frustum_culling(c: &mut Criterion) {
+    let view = Mat4::look_at_rh(Vec3::new(0.0, 5.0, 20.0), Vec3::ZERO, Vec3::Y);
+    let proj = Mat4::perspective_rh(60f32.to_radians(), 16.0 / 9.0, 0.1, 500.0);
+    let frustum = Frustum::from_view_projection(proj * view);
+
+    let mut state = 42u64;
+    let aabbs: Vec<AABB> = (0..10_000)
+        .map(|_| {
+            let center = Vec3::new(
+                (lcg(&mut state) - 0.5) * 200.0,
+                (lcg(&mut state) - 0.5) * 40.0,
+                (lcg(&mut state) - 0.5) * 200.0,
+            );
+            AABB::new(center - Vec3::ONE, center + Vec3::ONE)
+        })
+        .collect();
+
+    c.bench_function("frustum_cull_10k_aabbs", |b| {
+        b.iter(|| {
+            let mut visible = 0u32;
+            for aabb in &aabbs {
+                if frustum.intersects_aabb(black_box(aabb)) {
+                    visible += 1;
+                }
+            }
+            black_box(visible)
+        })
+    });
+}
+
+#[derive(Clone, Copy)]
+struct Position(Vec3);
+#[derive(Clone, Copy)]
+struct Velocity(Vec3);
+
+fn bench_ecs_query(c: &mut Criterion) {
+    let mut world = World::new();
+    let mut state = 7u64;
+    for _ in 0..10_000 {
+        let e = world.create_entity();
+        world.add_component(e, Position(Vec3::splat(lcg(&mut state))));
+        // Half the entities also carry a velocity, so query2 has gaps to skip.
+        if state % 2 == 0 {
+            world.add_component(e, Velocity(Vec3::Y));
+        }
+    }
+
+    c.bench_function("ecs_query_10k", |b| {
+        b.iter(|| {
+            let mut sum = Vec3::ZERO;
+            for (_, pos) in world.query::<Position>() {
+                sum += pos.0;
+            }
+            black_box(sum)
+        })
+    });
+
+    c.bench_function("ecs_query2_10k", |b| {
+        b.iter(|| {
+            let mut sum = Vec3::ZERO;
+            for (_, pos, vel) in world.query2::<Position, Velocity>() {
+                sum += pos.0 + vel.0;
+            }
+            black_box(sum)
+        })
+    });
+}
+
+fn bench_particle_update(c: &mut Criterion) {
+    let mut system = ParticleSystem::new(ParticleSystemConfig {
+        max_particles: 10_000,
+        emission_rate: 0.0,
+        // Long lifetimes keep all 10k particles alive across iterations, so
+        // every iteration measures the same amount of simulation work.
+        lifetime: RandomRange::new(1.0e6, 2.0e6),
+        ..Default::default()
+    });
+    system.play();
+    system.burst(10_000);
+
+    c.bench_function("particle_update_10k", |b| {
+        b.iter(|| {
+            system.update(black_box(1.0 / 60.0));
+        })
+    });
+}
+
+fn bench_linear_allocator(c: &mut Criterion) {
+    let allocator = LinearAllocator::new(1024 * 1024);
+
+    c.bench_function("linear_allocator_4k_allocs", |b| {
+        b.iter(|| {
+            allocator.reset();
+            for _ in 0..4096 {
+                black_box(allocator.allocate(64, 16));
+            }
+        })
+    });
+}
+
+fn bench_animation_sample(c: &mut Criterion) {
+    let mut track: AnimationTrack<Vec3> = AnimationTrack::new();
+    track.loop_mode = LoopMode::Loop;
+    for i in 0..64 {
+        track.add_keyframe(i as f32 * 0.1, Vec3::new(i as f32, 0.0, -(i as f32)));
+    }
+    let mut rotation: AnimationTrack<Quat> = AnimationTrack::new();
+    rotation.loop_mode = LoopMode::Loop;
+    for i in 0..64 {
+        rotation.add_keyframe(i as f32 * 0.1, Quat::from_rotation_y(i as f32 * 0.1));
+    }
+
+    c.bench_function("animation_sample_64_keys", |b| {
+        let mut t = 0.0f32;
+        b.iter(|| {
+            t += 0.016;
+            black_box(track.sample(t));
+            black_box(rotation.sample(t));
+        })
+    });
+}
+
+fn bench_asset_db(c: &mut Criterion) {
+    let mut db = AssetDatabase::in_memory().expect("in-memory sled db");
+    let ids: Vec<AssetId> = (0..1_000)
+        .map(|i| {
+            let path = format!("textures/bench_{i}.png");
+            let id = AssetId::from_path(&path);
+            let meta = AssetMetadata {
+                source_path: path,
+                content_hash: i,
+                last_modified: 0,
+                file_size: 4096,
+                asset_type: AssetType::Texture,
+                source_format: "png".to_string(),
+                runtime_format: None,
+                dependencies: Vec::new(),
+                dependents: Vec::new(),
+                extra: HashMap::new(),
+            };
+            db.register_asset(id, meta).expect("register");
+            id
+        })
+        .collect();
+
+    c.bench_function("asset_db_get_metadata_1k", |b| {
+        b.iter(|| {
+            for &id in &ids {
+                black_box(db.get_metadata(black_box(id)).unwrap());
+            }
+        })
+    });
+}
+
+fn bench_gltf_load(c: &mut Criterion) {
+    let mut group = c.benchmark_group("gltf_load");
+    // Full-file loads are slow; fewer samples keep the suite under a minute.
+    group.sample_size(10);
+    group.bench_function("zombie_basic_glb", |b| {
+        b.iter(|| {
+            black_box(
+                reactor_vulkan::resources::gltf_loader::load_gltf_simple(black_box(
+                    "assets/models/zombie_basic.glb",
+                ))
+                .expect("test model loads"),
+            )
+        })
+    });
+    group.finish();
+}
+
+criterion_group!(
+    benches,
+    bench_frustum_culling,
+    bench_ecs_query,
+    bench_particle_update,
+    bench_linear_allocator,
+    bench_animation_sample,
+    bench_asset_db,
+    bench_gltf_load
+);
+criterion_main!(benches);
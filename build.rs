@@ -33,6 +33,7 @@ fn shader_aliases() -> HashMap<&'static str, &'static str> {
     // ── Compute ──────────────────────────────────────────────────────────
     m.insert("cull.comp", "shaders/compute/cull.spv");
     m.insert("light_cull.comp", "shaders/compute/light_cull.spv");
+    m.insert("skinning.comp", "shaders/compute/skinning.spv");
     // ── IBL baking ───────────────────────────────────────────────────────
     m.insert("equirect_to_cube.comp", "shaders/ibl/equirect_to_cube.spv");
     m.insert("irradiance.comp", "shaders/ibl/irradiance.spv");
@@ -41,6 +42,13 @@ fn shader_aliases() -> HashMap<&'static str, &'static str> {
     // ── Particles ────────────────────────────────────────────────────────
     m.insert("particle.vert", "shaders/particles/particle_vert.spv");
     m.insert("particle.frag", "shaders/particles/particle_frag.spv");
+    m.insert("particle_prepare.comp", "shaders/particles/particle_prepare.spv");
+    m.insert("particle_emit.comp", "shaders/particles/particle_emit.spv");
+    m.insert("particle_update.comp", "shaders/particles/particle_update.spv");
+    // ── Meshlets (EXT_mesh_shader) ───────────────────────────────────────
+    m.insert("meshlet.task", "shaders/meshlet/meshlet_task.spv");
+    m.insert("meshlet.mesh", "shaders/meshlet/meshlet_mesh.spv");
+    m.insert("meshlet.frag", "shaders/meshlet/meshlet_frag.spv");
     // ── Blender Live Link ────────────────────────────────────────────────
     m.insert("blender_live.vert", "shaders/blender_live_vert.spv");
     m.insert("blender_live.frag", "shaders/blender_live_frag.spv");
@@ -50,6 +58,9 @@ fn shader_aliases() -> HashMap<&'static str, &'static str> {
 }
 
 fn compile_shader(src: &str, dst: &str) {
+    // Task/mesh shaders (EXT_mesh_shader) requieren SPIR-V 1.4+.
+    let needs_vulkan13 = src.ends_with(".task") || src.ends_with(".mesh");
+
     let src_path = Path::new(src);
     let dst_path = Path::new(dst);
 
@@ -71,16 +82,12 @@ fn compile_shader(src: &str, dst: &str) {
 
     println!("cargo:warning=Compiling shader: {} -> {}", src, dst);
 
-    let status = Command::new("glslc")
-        .args([
-            "-I",
-            "shaders/lib",
-            "-O",
-            src,
-            "-o",
-            dst,
-        ])
-        .status();
+    let mut args = vec!["-I", "shaders/lib", "-O"];
+    if needs_vulkan13 {
+        args.push("--target-env=vulkan1.3");
+    }
+    args.extend_from_slice(&[src, "-o", dst]);
+    let status = Command::new("glslc").args(&args).status();
 
     match status {
         Ok(s) if s.success() => {}
@@ -135,7 +142,9 @@ fn main() {
 
         let Some(ext) = path.extension() else { continue };
         let ext_str = ext.to_string_lossy();
-        if ext_str != "vert" && ext_str != "frag" && ext_str != "comp" {
+        if ext_str != "vert" && ext_str != "frag" && ext_str != "comp"
+            && ext_str != "task" && ext_str != "mesh"
+        {
             continue;
         }
 
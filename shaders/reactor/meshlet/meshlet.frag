@@ -0,0 +1,28 @@
+#version 450
+#extension GL_EXT_nonuniform_qualifier : enable
+
+// =============================================================================
+// Meshlet Fragment Shader — forward bindless mínimo
+// =============================================================================
+// Muestra la textura base del material bindless (set 0) o el color de
+// vértice cuando el material no tiene textura asignada.
+// =============================================================================
+
+layout(location = 0) in vec3 in_color;
+layout(location = 1) in vec2 in_uv;
+layout(location = 2) in flat uint in_material;
+
+layout(location = 0) out vec4 out_color;
+
+layout(set = 0, binding = 0) uniform texture2D global_textures[];
+layout(set = 0, binding = 1) uniform sampler global_samplers[];
+
+void main() {
+    vec3 base = in_color;
+    if (in_material != 0xFFFFFFFFu) {
+        base *= texture(
+            nonuniformEXT(sampler2D(global_textures[in_material], global_samplers[0])),
+            in_uv).rgb;
+    }
+    out_color = vec4(base, 1.0);
+}
@@ -18,6 +18,8 @@ pub struct ReactorConfig {
     pub msaa_samples: u32,
     pub renderer: RendererMode,
     pub physics_hz: u32,
+    /// Frame rate cap del pacer (0 = sin límite; con vsync suele quedar en 0).
+    pub target_fps: u32,
     pub scene: Option<String>,
 }
 
@@ -33,6 +35,7 @@ impl ReactorConfig {
     pub fn with_msaa(mut self, samples: u32) -> Self { self.msaa_samples = samples; self }
     pub fn with_renderer(mut self, renderer: RendererMode) -> Self { self.renderer = renderer; self }
     pub fn with_physics_hz(mut self, hz: u32) -> Self { self.physics_hz = hz; self }
+    pub fn with_target_fps(mut self, fps: u32) -> Self { self.target_fps = fps; self }
     pub fn with_scene(mut self, scene: &str) -> Self { self.scene = Some(scene.to_string()); self }
 }
 
@@ -49,6 +52,7 @@ impl Default for ReactorConfig {
             msaa_samples: 1,
             renderer: RendererMode::default(),
             physics_hz: 0,
+            target_fps: 0,
             scene: None,
         }
     }
@@ -3,7 +3,7 @@ use winit::window::Window;
 
 use crate::app::config::ReactorConfig;
 use crate::platform::input::Input;
-use crate::platform::time::Time;
+use crate::platform::time::{FramePacer, FramePacingStats, Time};
 use crate::reactor::Reactor;
 use crate::resources::{
     AssetDatabase, AssetHotReloadManager, AssetId, AssetLoaderQueue, AssetManager,
@@ -13,6 +13,8 @@ use crate::resources::{
 pub struct ReactorContext {
     pub window: Arc<Window>,
     pub time: Time,
+    pub pacer: FramePacer,
+    pub pacing: FramePacingStats,
     pub config: ReactorConfig,
     pub camera: crate::scene::camera::Camera,
     pub scene: crate::systems::scene::Scene,
@@ -11,7 +11,7 @@ use winit::{
 use crate::app::config::RendererMode;
 use crate::app::context::ReactorContext;
 use crate::app::ReactorApp;
-use crate::platform::time::Time;
+use crate::platform::time::{FramePacer, FramePacingStats, Time};
 use crate::reactor::Reactor;
 use crate::resources::{
     AssetDatabase, AssetHotReloadManager, AssetLoaderQueue, AssetManager, GltfLoader,
@@ -60,7 +60,10 @@ impl<A: ReactorApp> ApplicationHandler for AppRunner<A> {
         let hot_reload_rx = if asset_hot_reload.is_some() { Some(hot_reload_rx) } else { None };
         let mut ctx = ReactorContext {
             reactor, window,
-            time: Time::new(), config: config.clone(),
+            time: Time::new(),
+            pacer: FramePacer::with_target_fps(config.target_fps),
+            pacing: FramePacingStats::new(),
+            config: config.clone(),
             camera: crate::scene::camera::Camera::perspective(60.0, aspect, 0.1, 1000.0),
             scene: crate::systems::scene::Scene::new(),
             lighting: crate::systems::lighting::LightingSystem::new(),
@@ -93,6 +96,10 @@ impl<A: ReactorApp> ApplicationHandler for AppRunner<A> {
                 }
                 ctx.time.update();
                 let dt = ctx.time.delta();
+                // Muestreo diferido: el input se samplea justo antes de la
+                // simulación (no al llegar los eventos) y ese timestamp ancla
+                // la latencia input→present.
+                let input_sampled = ctx.reactor.input.sample();
                 if ctx.config.physics_hz > 0 {
                     let fixed_dt = 1.0 / ctx.config.physics_hz as f32;
                     ctx.fixed_accumulator += dt;
@@ -103,8 +110,11 @@ impl<A: ReactorApp> ApplicationHandler for AppRunner<A> {
                 }
                 self.app.update(ctx);
                 self.app.render(ctx);
+                ctx.pacing.record_input_latency(input_sampled.elapsed());
                 ctx.reactor.input.begin_frame();
                 if ctx.reactor.device_lost || ctx.reactor.exit_requested { event_loop.exit(); return; }
+                let slack = ctx.pacer.pace();
+                ctx.pacing.record_frame(ctx.time.delta_duration(), ctx.pacer.target(), slack);
                 ctx.window.request_redraw();
             }
             _ => {}
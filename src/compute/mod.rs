@@ -4,9 +4,12 @@
 pub mod dispatch;
 pub mod particles;
 pub mod pipeline;
+pub mod skinning;
 
 pub use dispatch::ComputeDispatch;
 pub use particles::{
-    EmitShape, GPUParticle, GPUParticleEmitterConfig, GPUParticleSystem, ParticlePushConstants,
+    EmitPushConstants, EmitShape, GPUParticle, GPUParticleEmitterConfig, GPUParticleSystem,
+    GpuParticlePool, ParticlePushConstants,
 };
 pub use pipeline::ComputePipeline;
+pub use skinning::{GpuSkinning, SkinnedVertexInput, SkinningPushConstants};
@@ -2,7 +2,16 @@
 // GPU Particles — Compute shader based particle system
 // =============================================================================
 
+use crate::compute::pipeline::ComputePipeline;
+use crate::core::error::ReactorResult;
+use crate::core::VulkanContext;
+use crate::graphics::Buffer;
+use ash::vk;
+use bytemuck::{Pod, Zeroable};
 use glam::{Vec3, Vec4};
+use gpu_allocator::vulkan::Allocator;
+use gpu_allocator::MemoryLocation;
+use std::sync::{Arc, Mutex};
 
 /// GPU Particle data (matches shader layout)
 #[repr(C)]
@@ -90,7 +99,7 @@ pub enum EmitShape {
 
 /// GPU Particle system push constants
 #[repr(C)]
-#[derive(Clone, Copy, Debug, Default)]
+#[derive(Clone, Copy, Debug, Default, Pod, Zeroable)]
 pub struct ParticlePushConstants {
     pub delta_time: f32,
     pub emit_count: u32,
@@ -266,3 +275,420 @@ impl GPUParticleEmitterConfig {
         }
     }
 }
+
+// =============================================================================
+// GPU pool with compaction + indirect dispatch/draw
+// =============================================================================
+
+/// Push constants for `particle_emit.comp`. 80 bytes.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default, Pod, Zeroable)]
+pub struct EmitPushConstants {
+    pub emitter_position: [f32; 4],
+    pub start_color: [f32; 4],
+    pub end_color: [f32; 4],
+    pub lifetime: f32,
+    pub lifetime_variance: f32,
+    pub initial_speed: f32,
+    pub speed_variance: f32,
+    pub start_size: f32,
+    pub end_size: f32,
+    pub emit_count: u32,
+    pub time: f32,
+}
+
+impl EmitPushConstants {
+    pub fn from_system(system: &GPUParticleSystem, emit_count: u32, time: f32) -> Self {
+        let c = &system.config;
+        Self {
+            emitter_position: [system.position.x, system.position.y, system.position.z, 1.0],
+            start_color: c.start_color.to_array(),
+            end_color: c.end_color.to_array(),
+            lifetime: c.lifetime,
+            lifetime_variance: c.lifetime_variance,
+            initial_speed: c.initial_speed,
+            speed_variance: c.speed_variance,
+            start_size: c.start_size,
+            end_size: c.end_size,
+            emit_count,
+            time,
+        }
+    }
+}
+
+/// `local_size_x` of the emit/update shaders.
+const PARTICLE_GROUP_SIZE: u32 = 64;
+/// Byte offset of the `VkDrawIndirectCommand` inside the args buffer
+/// (offset 0 holds the `VkDispatchIndirectCommand` for the update pass).
+const DRAW_ARGS_OFFSET: u64 = 16;
+
+/// GPU particle pool with dead-index freelist and live-list compaction.
+///
+/// Wraps `particle_prepare.comp` / `particle_emit.comp` /
+/// `particle_update.comp`. The pool itself never moves; instead two
+/// ping-ponged live-index lists track which slots are alive, a freelist
+/// recycles dead slots, and a single args buffer carries both the indirect
+/// dispatch size for the update pass and the indirect draw arguments — so
+/// per-frame GPU work scales with the live count, not pool capacity.
+///
+/// Frame sequence (all GPU-side, one `record()` call):
+/// 1. emit     — pop freelist slots, init particles, append to live-in
+/// 2. prepare  — live-in count → dispatch args; reset live-out + draw args
+/// 3. update   — indirect dispatch over live-in; dead slots → freelist,
+///               survivors → live-out + draw instance count
+pub struct GpuParticlePool {
+    device: ash::Device,
+    prepare: Option<ComputePipeline>,
+    emit: Option<ComputePipeline>,
+    update: Option<ComputePipeline>,
+    descriptor_layout: vk::DescriptorSetLayout,
+    descriptor_pool: vk::DescriptorPool,
+    /// One set per live-list parity: [A→B, B→A].
+    descriptor_sets: Vec<vk::DescriptorSet>,
+    pool_buffer: Buffer,
+    freelist_buffer: Buffer,
+    live_buffers: [Buffer; 2],
+    args_buffer: Buffer,
+    capacity: u32,
+    /// Which live buffer is the input this frame (0 or 1).
+    parity: usize,
+}
+
+impl GpuParticlePool {
+    pub fn new(
+        ctx: &VulkanContext,
+        allocator: Arc<Mutex<Allocator>>,
+        capacity: u32,
+    ) -> ReactorResult<Self> {
+        let device = ctx.ash_device().clone();
+
+        let bindings: Vec<vk::DescriptorSetLayoutBinding> = (0..5)
+            .map(|i| {
+                vk::DescriptorSetLayoutBinding::default()
+                    .binding(i)
+                    .descriptor_type(vk::DescriptorType::STORAGE_BUFFER)
+                    .descriptor_count(1)
+                    .stage_flags(vk::ShaderStageFlags::COMPUTE)
+            })
+            .collect();
+        let layout_info = vk::DescriptorSetLayoutCreateInfo::default().bindings(&bindings);
+        let descriptor_layout =
+            unsafe { device.create_descriptor_set_layout(&layout_info, None)? };
+
+        let load = |bytes: &[u8]| -> ReactorResult<Vec<u32>> {
+            Ok(ash::util::read_spv(&mut std::io::Cursor::new(bytes))?)
+        };
+        let prepare_spv = load(include_bytes!("../../shaders/particles/particle_prepare.spv"))?;
+        let emit_spv = load(include_bytes!("../../shaders/particles/particle_emit.spv"))?;
+        let update_spv = load(include_bytes!("../../shaders/particles/particle_update.spv"))?;
+
+        let prepare = ComputePipeline::new(ctx, &prepare_spv, &[descriptor_layout], None)?;
+        let emit = ComputePipeline::new(
+            ctx,
+            &emit_spv,
+            &[descriptor_layout],
+            Some(std::mem::size_of::<EmitPushConstants>() as u32),
+        )?;
+        let update = ComputePipeline::new(
+            ctx,
+            &update_spv,
+            &[descriptor_layout],
+            Some(std::mem::size_of::<ParticlePushConstants>() as u32),
+        )?;
+
+        let pool_buffer = Buffer::new(
+            ctx,
+            allocator.clone(),
+            capacity as u64 * std::mem::size_of::<GPUParticle>() as u64,
+            vk::BufferUsageFlags::STORAGE_BUFFER | vk::BufferUsageFlags::VERTEX_BUFFER,
+            MemoryLocation::GpuOnly,
+        )?;
+
+        // Freelist starts full: every slot is dead and available.
+        let freelist_buffer = Buffer::new(
+            ctx,
+            allocator.clone(),
+            4 + capacity as u64 * 4,
+            vk::BufferUsageFlags::STORAGE_BUFFER,
+            MemoryLocation::CpuToGpu,
+        )?;
+        let mut freelist_init = Vec::with_capacity(capacity as usize + 1);
+        freelist_init.push(capacity);
+        freelist_init.extend(0..capacity);
+        freelist_buffer.write(&freelist_init);
+
+        // Live lists start empty (count = 0).
+        let make_live = || -> ReactorResult<Buffer> {
+            let buf = Buffer::new(
+                ctx,
+                allocator.clone(),
+                4 + capacity as u64 * 4,
+                vk::BufferUsageFlags::STORAGE_BUFFER,
+                MemoryLocation::CpuToGpu,
+            )?;
+            buf.write(&[0u32]);
+            Ok(buf)
+        };
+        let live_buffers = [make_live()?, make_live()?];
+
+        let args_buffer = Buffer::new(
+            ctx,
+            allocator.clone(),
+            32,
+            vk::BufferUsageFlags::STORAGE_BUFFER | vk::BufferUsageFlags::INDIRECT_BUFFER,
+            MemoryLocation::GpuOnly,
+        )?;
+
+        let pool_sizes = [vk::DescriptorPoolSize::default()
+            .ty(vk::DescriptorType::STORAGE_BUFFER)
+            .descriptor_count(2 * 5)];
+        let pool_info = vk::DescriptorPoolCreateInfo::default()
+            .pool_sizes(&pool_sizes)
+            .max_sets(2);
+        let descriptor_pool = unsafe { device.create_descriptor_pool(&pool_info, None)? };
+
+        let layouts = [descriptor_layout; 2];
+        let alloc_info = vk::DescriptorSetAllocateInfo::default()
+            .descriptor_pool(descriptor_pool)
+            .set_layouts(&layouts);
+        let descriptor_sets = unsafe { device.allocate_descriptor_sets(&alloc_info)? };
+
+        for (parity, &set) in descriptor_sets.iter().enumerate() {
+            let live_in = &live_buffers[parity];
+            let live_out = &live_buffers[1 - parity];
+            let infos = [
+                vk::DescriptorBufferInfo::default()
+                    .buffer(pool_buffer.handle)
+                    .range(vk::WHOLE_SIZE),
+                vk::DescriptorBufferInfo::default()
+                    .buffer(freelist_buffer.handle)
+                    .range(vk::WHOLE_SIZE),
+                vk::DescriptorBufferInfo::default()
+                    .buffer(live_in.handle)
+                    .range(vk::WHOLE_SIZE),
+                vk::DescriptorBufferInfo::default()
+                    .buffer(live_out.handle)
+                    .range(vk::WHOLE_SIZE),
+                vk::DescriptorBufferInfo::default()
+                    .buffer(args_buffer.handle)
+                    .range(32),
+            ];
+            let writes: Vec<vk::WriteDescriptorSet> = infos
+                .iter()
+                .enumerate()
+                .map(|(i, info)| {
+                    vk::WriteDescriptorSet::default()
+                        .dst_set(set)
+                        .dst_binding(i as u32)
+                        .descriptor_type(vk::DescriptorType::STORAGE_BUFFER)
+                        .buffer_info(std::slice::from_ref(info))
+                })
+                .collect();
+            unsafe {
+                device.update_descriptor_sets(&writes, &[]);
+            }
+        }
+
+        Ok(Self {
+            device,
+            prepare: Some(prepare),
+            emit: Some(emit),
+            update: Some(update),
+            descriptor_layout,
+            descriptor_pool,
+            descriptor_sets,
+            pool_buffer,
+            freelist_buffer,
+            live_buffers,
+            args_buffer,
+            capacity,
+            parity: 0,
+        })
+    }
+
+    /// Record one frame: emit → prepare → indirect update. Flips the
+    /// live-list parity afterwards.
+    pub fn record(
+        &mut self,
+        command_buffer: vk::CommandBuffer,
+        update_push: &ParticlePushConstants,
+        emit_push: &EmitPushConstants,
+    ) {
+        let (Some(prepare), Some(emit), Some(update)) =
+            (self.prepare.as_ref(), self.emit.as_ref(), self.update.as_ref())
+        else {
+            return;
+        };
+        let device = &self.device;
+        let set = self.descriptor_sets[self.parity];
+
+        unsafe {
+            // ── 1. Emit new particles from the freelist ──
+            if emit_push.emit_count > 0 {
+                emit.bind(command_buffer, device);
+                device.cmd_bind_descriptor_sets(
+                    command_buffer,
+                    vk::PipelineBindPoint::COMPUTE,
+                    emit.layout,
+                    0,
+                    &[set],
+                    &[],
+                );
+                device.cmd_push_constants(
+                    command_buffer,
+                    emit.layout,
+                    vk::ShaderStageFlags::COMPUTE,
+                    0,
+                    bytemuck::bytes_of(emit_push),
+                );
+                let groups =
+                    (emit_push.emit_count + PARTICLE_GROUP_SIZE - 1) / PARTICLE_GROUP_SIZE;
+                device.cmd_dispatch(command_buffer, groups, 1, 1);
+                self.compute_to_compute_barrier(command_buffer);
+            }
+
+            // ── 2. Prepare: live count → dispatch args, reset frame state ──
+            prepare.bind(command_buffer, device);
+            device.cmd_bind_descriptor_sets(
+                command_buffer,
+                vk::PipelineBindPoint::COMPUTE,
+                prepare.layout,
+                0,
+                &[set],
+                &[],
+            );
+            device.cmd_dispatch(command_buffer, 1, 1, 1);
+
+            // Dispatch args must be visible to the indirect-dispatch stage
+            // and the shared buffers to the update shader.
+            let args_barrier = vk::BufferMemoryBarrier::default()
+                .src_access_mask(vk::AccessFlags::SHADER_WRITE)
+                .dst_access_mask(
+                    vk::AccessFlags::INDIRECT_COMMAND_READ | vk::AccessFlags::SHADER_WRITE,
+                )
+                .src_queue_family_index(vk::QUEUE_FAMILY_IGNORED)
+                .dst_queue_family_index(vk::QUEUE_FAMILY_IGNORED)
+                .buffer(self.args_buffer.handle)
+                .offset(0)
+                .size(32);
+            device.cmd_pipeline_barrier(
+                command_buffer,
+                vk::PipelineStageFlags::COMPUTE_SHADER,
+                vk::PipelineStageFlags::DRAW_INDIRECT | vk::PipelineStageFlags::COMPUTE_SHADER,
+                vk::DependencyFlags::empty(),
+                &[vk::MemoryBarrier::default()
+                    .src_access_mask(vk::AccessFlags::SHADER_WRITE)
+                    .dst_access_mask(vk::AccessFlags::SHADER_READ | vk::AccessFlags::SHADER_WRITE)],
+                &[args_barrier],
+                &[],
+            );
+
+            // ── 3. Update + compact, sized by the GPU-side live count ──
+            update.bind(command_buffer, device);
+            device.cmd_bind_descriptor_sets(
+                command_buffer,
+                vk::PipelineBindPoint::COMPUTE,
+                update.layout,
+                0,
+                &[set],
+                &[],
+            );
+            device.cmd_push_constants(
+                command_buffer,
+                update.layout,
+                vk::ShaderStageFlags::COMPUTE,
+                0,
+                bytemuck::bytes_of(update_push),
+            );
+            device.cmd_dispatch_indirect(command_buffer, self.args_buffer.handle, 0);
+
+            // Survivor list + draw args → vertex stage / indirect draw.
+            let draw_barrier = vk::BufferMemoryBarrier::default()
+                .src_access_mask(vk::AccessFlags::SHADER_WRITE)
+                .dst_access_mask(vk::AccessFlags::INDIRECT_COMMAND_READ)
+                .src_queue_family_index(vk::QUEUE_FAMILY_IGNORED)
+                .dst_queue_family_index(vk::QUEUE_FAMILY_IGNORED)
+                .buffer(self.args_buffer.handle)
+                .offset(DRAW_ARGS_OFFSET)
+                .size(16);
+            device.cmd_pipeline_barrier(
+                command_buffer,
+                vk::PipelineStageFlags::COMPUTE_SHADER,
+                vk::PipelineStageFlags::DRAW_INDIRECT | vk::PipelineStageFlags::VERTEX_SHADER,
+                vk::DependencyFlags::empty(),
+                &[vk::MemoryBarrier::default()
+                    .src_access_mask(vk::AccessFlags::SHADER_WRITE)
+                    .dst_access_mask(vk::AccessFlags::SHADER_READ)],
+                &[draw_barrier],
+                &[],
+            );
+        }
+
+        // Next frame reads what this frame compacted.
+        self.parity = 1 - self.parity;
+    }
+
+    /// Draw all live particles: one indirect draw whose instance count was
+    /// accumulated on the GPU. Bind the particle pipeline first.
+    pub fn draw(&self, command_buffer: vk::CommandBuffer) {
+        unsafe {
+            self.device.cmd_draw_indirect(
+                command_buffer,
+                self.args_buffer.handle,
+                DRAW_ARGS_OFFSET,
+                1,
+                16,
+            );
+        }
+    }
+
+    fn compute_to_compute_barrier(&self, command_buffer: vk::CommandBuffer) {
+        let barrier = vk::MemoryBarrier::default()
+            .src_access_mask(vk::AccessFlags::SHADER_WRITE)
+            .dst_access_mask(vk::AccessFlags::SHADER_READ | vk::AccessFlags::SHADER_WRITE);
+        unsafe {
+            self.device.cmd_pipeline_barrier(
+                command_buffer,
+                vk::PipelineStageFlags::COMPUTE_SHADER,
+                vk::PipelineStageFlags::COMPUTE_SHADER,
+                vk::DependencyFlags::empty(),
+                &[barrier],
+                &[],
+                &[],
+            );
+        }
+    }
+
+    /// Particle pool SSBO (bind in the particle vertex shader).
+    pub fn pool_buffer(&self) -> vk::Buffer {
+        self.pool_buffer.handle
+    }
+
+    /// Live-index list the vertex shader should read this frame
+    /// (the output list of the most recent `record()`).
+    pub fn live_list_buffer(&self) -> vk::Buffer {
+        self.live_buffers[self.parity].handle
+    }
+
+    pub fn capacity(&self) -> u32 {
+        self.capacity
+    }
+
+    pub fn destroy(&mut self) {
+        self.descriptor_sets.clear();
+        self.prepare = None;
+        self.emit = None;
+        self.update = None;
+        self.pool_buffer.destroy();
+        self.freelist_buffer.destroy();
+        self.live_buffers[0].destroy();
+        self.live_buffers[1].destroy();
+        self.args_buffer.destroy();
+        unsafe {
+            self.device
+                .destroy_descriptor_pool(self.descriptor_pool, None);
+            self.device
+                .destroy_descriptor_set_layout(self.descriptor_layout, None);
+        }
+    }
+}
@@ -0,0 +1,277 @@
+// =============================================================================
+// GPU Skinning — Compute shader joint-palette skinning
+// =============================================================================
+// Skins rest-pose vertices against joint palettes on the GPU so the CPU never
+// touches per-vertex data: `AnimationBatch` builds the contiguous palette,
+// one upload per frame, and a single compute pass writes `Vertex`-layout
+// output straight into a buffer the existing pipelines can bind as a vertex
+// buffer.
+
+use crate::compute::dispatch::ComputeDispatch;
+use crate::compute::pipeline::ComputePipeline;
+use crate::core::error::ReactorResult;
+use crate::core::VulkanContext;
+use crate::graphics::Buffer;
+use ash::vk;
+use bytemuck::{Pod, Zeroable};
+use gpu_allocator::vulkan::Allocator;
+use gpu_allocator::MemoryLocation;
+use std::sync::{Arc, Mutex};
+
+/// Rest-pose vertex with skinning attributes (matches shader layout). The
+/// first three vec4s mirror `Vertex` (position, color, uv); joints index into
+/// the palette for the instance being skinned.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default, Pod, Zeroable)]
+pub struct SkinnedVertexInput {
+    pub position: [f32; 4],
+    pub color: [f32; 4],
+    pub uv: [f32; 2],
+    pub _pad: [f32; 2],
+    pub joints: [u32; 4],
+    pub weights: [f32; 4],
+}
+
+/// Push constants for `skinning.comp`. One dispatch per skinned instance.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default, Pod, Zeroable)]
+pub struct SkinningPushConstants {
+    /// Vertices to skin this dispatch.
+    pub vertex_count: u32,
+    /// First rest-pose vertex of the instance's mesh.
+    pub input_offset: u32,
+    /// First joint matrix of the instance's palette.
+    pub palette_offset: u32,
+    /// First output vertex (instances pack into one output buffer).
+    pub output_offset: u32,
+}
+
+/// `local_size_x` of the skinning shader.
+const SKINNING_GROUP_SIZE: u32 = 64;
+/// Floats per output vertex (`Vertex` layout: position, color, uv).
+const OUTPUT_FLOATS_PER_VERTEX: u64 = 8;
+
+/// Compute-shader skinning pass.
+///
+/// Holds three buffers: rest-pose vertices with joint indices/weights
+/// (uploaded once per mesh set), the joint palettes (rewritten per frame),
+/// and the skinned output in `Vertex` layout with
+/// `STORAGE_BUFFER | VERTEX_BUFFER` usage so draws consume it directly.
+pub struct GpuSkinning {
+    device: ash::Device,
+    pipeline: Option<ComputePipeline>,
+    descriptor_layout: vk::DescriptorSetLayout,
+    descriptor_pool: vk::DescriptorPool,
+    descriptor_set: vk::DescriptorSet,
+    input_buffer: Buffer,
+    palette_buffer: Buffer,
+    output_buffer: Buffer,
+    vertex_capacity: u32,
+    joint_capacity: u32,
+}
+
+impl GpuSkinning {
+    pub fn new(
+        ctx: &VulkanContext,
+        allocator: Arc<Mutex<Allocator>>,
+        vertex_capacity: u32,
+        joint_capacity: u32,
+    ) -> ReactorResult<Self> {
+        let device = ctx.ash_device().clone();
+
+        let bindings: Vec<vk::DescriptorSetLayoutBinding> = (0..3)
+            .map(|i| {
+                vk::DescriptorSetLayoutBinding::default()
+                    .binding(i)
+                    .descriptor_type(vk::DescriptorType::STORAGE_BUFFER)
+                    .descriptor_count(1)
+                    .stage_flags(vk::ShaderStageFlags::COMPUTE)
+            })
+            .collect();
+        let layout_info = vk::DescriptorSetLayoutCreateInfo::default().bindings(&bindings);
+        let descriptor_layout =
+            unsafe { device.create_descriptor_set_layout(&layout_info, None)? };
+
+        let spv = ash::util::read_spv(&mut std::io::Cursor::new(include_bytes!(
+            "../../shaders/compute/skinning.spv"
+        )))?;
+        let pipeline = ComputePipeline::new(
+            ctx,
+            &spv,
+            &[descriptor_layout],
+            Some(std::mem::size_of::<SkinningPushConstants>() as u32),
+        )?;
+
+        let input_buffer = Buffer::new(
+            ctx,
+            allocator.clone(),
+            vertex_capacity as u64 * std::mem::size_of::<SkinnedVertexInput>() as u64,
+            vk::BufferUsageFlags::STORAGE_BUFFER,
+            MemoryLocation::CpuToGpu,
+        )?;
+
+        // Palettes are rewritten every frame from `AnimationBatch`.
+        let palette_buffer = Buffer::new(
+            ctx,
+            allocator.clone(),
+            joint_capacity as u64 * 64,
+            vk::BufferUsageFlags::STORAGE_BUFFER,
+            MemoryLocation::CpuToGpu,
+        )?;
+
+        let output_buffer = Buffer::new(
+            ctx,
+            allocator.clone(),
+            vertex_capacity as u64 * OUTPUT_FLOATS_PER_VERTEX * 4,
+            vk::BufferUsageFlags::STORAGE_BUFFER | vk::BufferUsageFlags::VERTEX_BUFFER,
+            MemoryLocation::GpuOnly,
+        )?;
+
+        let pool_sizes = [vk::DescriptorPoolSize::default()
+            .ty(vk::DescriptorType::STORAGE_BUFFER)
+            .descriptor_count(3)];
+        let pool_info = vk::DescriptorPoolCreateInfo::default()
+            .pool_sizes(&pool_sizes)
+            .max_sets(1);
+        let descriptor_pool = unsafe { device.create_descriptor_pool(&pool_info, None)? };
+
+        let layouts = [descriptor_layout];
+        let alloc_info = vk::DescriptorSetAllocateInfo::default()
+            .descriptor_pool(descriptor_pool)
+            .set_layouts(&layouts);
+        let descriptor_set = unsafe { device.allocate_descriptor_sets(&alloc_info)? }[0];
+
+        let infos = [
+            vk::DescriptorBufferInfo::default()
+                .buffer(input_buffer.handle)
+                .range(vk::WHOLE_SIZE),
+            vk::DescriptorBufferInfo::default()
+                .buffer(palette_buffer.handle)
+                .range(vk::WHOLE_SIZE),
+            vk::DescriptorBufferInfo::default()
+                .buffer(output_buffer.handle)
+                .range(vk::WHOLE_SIZE),
+        ];
+        let writes: Vec<vk::WriteDescriptorSet> = infos
+            .iter()
+            .enumerate()
+            .map(|(i, info)| {
+                vk::WriteDescriptorSet::default()
+                    .dst_set(descriptor_set)
+                    .dst_binding(i as u32)
+                    .descriptor_type(vk::DescriptorType::STORAGE_BUFFER)
+                    .buffer_info(std::slice::from_ref(info))
+            })
+            .collect();
+        unsafe {
+            device.update_descriptor_sets(&writes, &[]);
+        }
+
+        Ok(Self {
+            device,
+            pipeline: Some(pipeline),
+            descriptor_layout,
+            descriptor_pool,
+            descriptor_set,
+            input_buffer,
+            palette_buffer,
+            output_buffer,
+            vertex_capacity,
+            joint_capacity,
+        })
+    }
+
+    /// Upload rest-pose vertices (typically once, at mesh load).
+    pub fn upload_vertices(&self, vertices: &[SkinnedVertexInput]) {
+        debug_assert!(vertices.len() <= self.vertex_capacity as usize);
+        self.input_buffer.write(vertices);
+    }
+
+    /// Upload this frame's joint palettes (column-major mat4s, e.g. from
+    /// `AnimationBatch::build_pose_matrices`).
+    pub fn upload_palettes(&self, matrices: &[[[f32; 4]; 4]]) {
+        debug_assert!(matrices.len() <= self.joint_capacity as usize);
+        self.palette_buffer.write(matrices);
+    }
+
+    /// Record one skinning dispatch per instance, then a barrier handing the
+    /// output buffer to the vertex-input stage.
+    pub fn record(&self, command_buffer: vk::CommandBuffer, instances: &[SkinningPushConstants]) {
+        let Some(pipeline) = self.pipeline.as_ref() else {
+            return;
+        };
+        if instances.is_empty() {
+            return;
+        }
+
+        for push in instances {
+            unsafe {
+                self.device.cmd_push_constants(
+                    command_buffer,
+                    pipeline.layout,
+                    vk::ShaderStageFlags::COMPUTE,
+                    0,
+                    bytemuck::bytes_of(push),
+                );
+            }
+            let groups = (push.vertex_count + SKINNING_GROUP_SIZE - 1) / SKINNING_GROUP_SIZE;
+            ComputeDispatch::dispatch(
+                &self.device,
+                command_buffer,
+                pipeline,
+                &[self.descriptor_set],
+                groups,
+                1,
+                1,
+            );
+        }
+
+        // Skinned vertices → vertex fetch of the draw that follows.
+        let barrier = vk::BufferMemoryBarrier::default()
+            .src_access_mask(vk::AccessFlags::SHADER_WRITE)
+            .dst_access_mask(vk::AccessFlags::VERTEX_ATTRIBUTE_READ)
+            .src_queue_family_index(vk::QUEUE_FAMILY_IGNORED)
+            .dst_queue_family_index(vk::QUEUE_FAMILY_IGNORED)
+            .buffer(self.output_buffer.handle)
+            .offset(0)
+            .size(vk::WHOLE_SIZE);
+        unsafe {
+            self.device.cmd_pipeline_barrier(
+                command_buffer,
+                vk::PipelineStageFlags::COMPUTE_SHADER,
+                vk::PipelineStageFlags::VERTEX_INPUT,
+                vk::DependencyFlags::empty(),
+                &[],
+                &[barrier],
+                &[],
+            );
+        }
+    }
+
+    /// Skinned output in `Vertex` layout — bind as the vertex buffer for
+    /// skinned draws.
+    pub fn output_buffer(&self) -> vk::Buffer {
+        self.output_buffer.handle
+    }
+
+    pub fn vertex_capacity(&self) -> u32 {
+        self.vertex_capacity
+    }
+
+    pub fn joint_capacity(&self) -> u32 {
+        self.joint_capacity
+    }
+
+    pub fn destroy(&mut self) {
+        self.pipeline = None;
+        self.input_buffer.destroy();
+        self.palette_buffer.destroy();
+        self.output_buffer.destroy();
+        unsafe {
+            self.device
+                .destroy_descriptor_pool(self.descriptor_pool, None);
+            self.device
+                .destroy_descriptor_set_layout(self.descriptor_layout, None);
+        }
+    }
+}
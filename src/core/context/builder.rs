@@ -437,6 +437,10 @@ impl VulkanContext {
 
         let mut dynamic_rendering_features =
             vk::PhysicalDeviceDynamicRenderingFeatures::default().dynamic_rendering(true);
+        // Core in Vulkan 1.2; the async upload engine uses timeline semaphores
+        // to hand finished transfer-queue copies over to the graphics queue.
+        let mut timeline_semaphore_features =
+            vk::PhysicalDeviceTimelineSemaphoreFeatures::default().timeline_semaphore(true);
         let mut fragment_shading_rate_features =
             vk::PhysicalDeviceFragmentShadingRateFeaturesKHR::default()
                 .pipeline_fragment_shading_rate(true);
@@ -444,7 +448,8 @@ impl VulkanContext {
         let mut device_create_info = vk::DeviceCreateInfo::default()
             .queue_create_infos(&queue_create_infos)
             .enabled_extension_names(&device_extension_names)
-            .push_next(&mut dynamic_rendering_features);
+            .push_next(&mut dynamic_rendering_features)
+            .push_next(&mut timeline_semaphore_features);
 
         let mut buffer_device_address_features =
             vk::PhysicalDeviceBufferDeviceAddressFeatures::default().buffer_device_address(true);
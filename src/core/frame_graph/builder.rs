@@ -8,11 +8,20 @@ pub struct PassBuilder<'a> {
     reads: Vec<ResourceId>,
     writes: Vec<ResourceId>,
     order: i32,
+    queue: QueueClass,
 }
 
 impl<'a> PassBuilder<'a> {
     pub fn new(graph: &'a mut FrameGraph, pass_id: PassId, name: String) -> Self {
-        Self { graph, pass_id, name, reads: Vec::new(), writes: Vec::new(), order: 0 }
+        Self {
+            graph,
+            pass_id,
+            name,
+            reads: Vec::new(),
+            writes: Vec::new(),
+            order: 0,
+            queue: QueueClass::Graphics,
+        }
     }
 
     pub fn reads(mut self, resources: &[ResourceId]) -> Self {
@@ -40,6 +49,14 @@ impl<'a> PassBuilder<'a> {
         self
     }
 
+    /// Schedule this pass on the async compute queue so it overlaps raster
+    /// work. The compiled schedule inserts semaphore sync for any resource
+    /// crossing between queues.
+    pub fn on_async_compute(mut self) -> Self {
+        self.queue = QueueClass::AsyncCompute;
+        self
+    }
+
     pub fn build(self) -> PassId {
         let pass = PassDesc {
             id: self.pass_id,
@@ -48,6 +65,7 @@ impl<'a> PassBuilder<'a> {
             writes: self.writes,
             enabled: true,
             order: self.order,
+            queue: self.queue,
         };
         self.graph.passes.insert(self.pass_id, pass);
         self.pass_id
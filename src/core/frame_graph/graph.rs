@@ -8,6 +8,8 @@ pub struct FrameGraph {
     pub(super) passes: HashMap<PassId, PassDesc>,
     barriers: Vec<Barrier>,
     execution_order: Vec<PassId>,
+    alias_plan: AliasPlan,
+    schedule: QueueSchedule,
     next_resource_id: u32,
     next_pass_id: u32,
     compiled: bool,
@@ -110,6 +112,8 @@ impl FrameGraph {
 
         self.execution_order = sorted;
         self.generate_barriers();
+        self.plan_aliasing();
+        self.build_schedule();
 
         self.stats.total_passes = self.passes.len() as u32;
         self.stats.enabled_passes = self.execution_order.len() as u32;
@@ -117,6 +121,13 @@ impl FrameGraph {
         self.stats.transient_resources =
             self.resources.values().filter(|r| !r.persistent).count() as u32;
         self.stats.barriers_generated = self.barriers.len() as u32;
+        self.stats.alias_blocks = self.alias_plan.block_sizes.len() as u32;
+        self.stats.alias_bytes_saved = self
+            .alias_plan
+            .bytes_requested
+            .saturating_sub(self.alias_plan.bytes_allocated);
+        self.stats.async_compute_passes = self.schedule.async_compute.len() as u32;
+        self.stats.queue_sync_points = self.schedule.sync_points.len() as u32;
 
         self.compiled = true;
     }
@@ -184,6 +195,7 @@ impl FrameGraph {
                             to_pass: pass_id,
                             from_access: AccessType::Write,
                             to_access: AccessType::Read,
+                            kind: BarrierKind::Transition,
                         });
                     }
                 }
@@ -195,6 +207,162 @@ impl FrameGraph {
         }
     }
 
+    /// Assign transients with disjoint lifetimes to shared memory blocks.
+    ///
+    /// Lifetimes are index ranges in the execution order. Transients are
+    /// packed greedily, largest first, into the first block whose current
+    /// occupants they don't overlap; each block is later backed by a single
+    /// gpu-allocator allocation sized to its largest occupant. Every reuse
+    /// also emits an aliasing barrier so the executor serializes the old
+    /// occupant's last access against the new occupant's first write.
+    fn plan_aliasing(&mut self) {
+        self.alias_plan = AliasPlan::default();
+
+        // Lifetime = [first_use, last_use] over the execution order.
+        let mut lifetimes: HashMap<ResourceId, (u32, u32)> = HashMap::new();
+        for (order, &pass_id) in self.execution_order.iter().enumerate() {
+            let Some(pass) = self.passes.get(&pass_id) else { continue };
+            for &resource in pass.reads.iter().chain(pass.writes.iter()) {
+                let entry = lifetimes.entry(resource).or_insert((order as u32, order as u32));
+                entry.1 = order as u32;
+            }
+        }
+
+        let mut transients: Vec<(&ResourceDesc, u32, u32)> = self
+            .resources
+            .values()
+            .filter(|r| !r.persistent && r.resource_type != ResourceType::Swapchain)
+            .filter_map(|r| lifetimes.get(&r.id).map(|&(first, last)| (r, first, last)))
+            .collect();
+        // Largest first: big targets define block sizes, small ones fill gaps.
+        transients.sort_by(|a, b| {
+            let size = |r: &ResourceDesc| {
+                r.width as u64 * r.height as u64 * r.format.bytes_per_pixel()
+            };
+            size(b.0).cmp(&size(a.0)).then(a.0.id.0.cmp(&b.0.id.0))
+        });
+
+        // Per block: current occupants as (first, last, resource).
+        let mut blocks: Vec<Vec<(u32, u32, ResourceId)>> = Vec::new();
+        let mut alias_barriers = Vec::new();
+
+        for (res, first, last) in &transients {
+            let size = res.width as u64 * res.height as u64 * res.format.bytes_per_pixel();
+            self.alias_plan.bytes_requested += size;
+
+            let block = blocks
+                .iter()
+                .position(|occupants| {
+                    occupants.iter().all(|&(f, l, _)| *last < f || *first > l)
+                })
+                .unwrap_or_else(|| {
+                    blocks.push(Vec::new());
+                    self.alias_plan.block_sizes.push(0);
+                    blocks.len() - 1
+                });
+
+            // Aliasing barrier against the closest predecessor in the block.
+            if let Some(&(_, prev_last, prev_id)) = blocks[block]
+                .iter()
+                .filter(|&&(_, l, _)| l < *first)
+                .max_by_key(|&&(_, l, _)| l)
+            {
+                alias_barriers.push(Barrier {
+                    resource: res.id,
+                    from_pass: Some(self.execution_order[prev_last as usize]),
+                    to_pass: self.execution_order[*first as usize],
+                    from_access: AccessType::Write,
+                    to_access: AccessType::Write,
+                    kind: BarrierKind::Alias { previous: prev_id },
+                });
+            }
+
+            blocks[block].push((*first, *last, res.id));
+            self.alias_plan.block_sizes[block] = self.alias_plan.block_sizes[block].max(size);
+            self.alias_plan.allocations.push(AliasedAllocation {
+                resource: res.id,
+                block: block as u32,
+                size,
+                first_use: *first,
+                last_use: *last,
+            });
+        }
+
+        self.alias_plan.bytes_allocated = self.alias_plan.block_sizes.iter().sum();
+        self.barriers.extend(alias_barriers);
+    }
+
+    /// Split the execution order into per-queue submission lists and emit a
+    /// semaphore sync point for every resource edge that crosses queues.
+    ///
+    /// Passes keep their relative order inside each queue, so intra-queue
+    /// hazards are still covered by `barriers()`; only write→read and
+    /// write→write edges between the graphics and async-compute lists need
+    /// semaphores. Duplicate signal/wait pairs are collapsed so the executor
+    /// submits at most one semaphore per pass pair.
+    fn build_schedule(&mut self) {
+        self.schedule = QueueSchedule::default();
+
+        let mut last_write: HashMap<ResourceId, (PassId, QueueClass)> = HashMap::new();
+        let mut last_read: HashMap<ResourceId, (PassId, QueueClass)> = HashMap::new();
+
+        for &pass_id in &self.execution_order {
+            let Some(pass) = self.passes.get(&pass_id) else { continue };
+            match pass.queue {
+                QueueClass::Graphics => self.schedule.graphics.push(pass_id),
+                QueueClass::AsyncCompute => self.schedule.async_compute.push(pass_id),
+            }
+
+            for &resource in &pass.reads {
+                if let Some(&(writer, writer_queue)) = last_write.get(&resource) {
+                    if writer_queue != pass.queue {
+                        push_sync_point(
+                            &mut self.schedule.sync_points,
+                            writer,
+                            writer_queue,
+                            pass_id,
+                            pass.queue,
+                            resource,
+                        );
+                    }
+                }
+                last_read.insert(resource, (pass_id, pass.queue));
+            }
+
+            for &resource in &pass.writes {
+                // Write-after-write and write-after-read across queues both
+                // need the producer finished before the overwrite starts.
+                for prev in [last_write.get(&resource), last_read.get(&resource)] {
+                    if let Some(&(prev_pass, prev_queue)) = prev {
+                        if prev_queue != pass.queue {
+                            push_sync_point(
+                                &mut self.schedule.sync_points,
+                                prev_pass,
+                                prev_queue,
+                                pass_id,
+                                pass.queue,
+                                resource,
+                            );
+                        }
+                    }
+                }
+                last_write.insert(resource, (pass_id, pass.queue));
+            }
+        }
+    }
+
+    /// Memory aliasing plan for transient resources. Valid after `compile()`.
+    pub fn alias_plan(&self) -> &AliasPlan {
+        &self.alias_plan
+    }
+
+    /// Dual-queue submission schedule. Valid after `compile()`. On devices
+    /// without a dedicated compute queue the executor simply concatenates
+    /// both lists back into `execution_order()` and ignores the sync points.
+    pub fn schedule(&self) -> &QueueSchedule {
+        &self.schedule
+    }
+
     pub fn execution_order(&self) -> &[PassId] {
         &self.execution_order
     }
@@ -261,7 +429,154 @@ impl FrameGraph {
         self.passes.clear();
         self.barriers.clear();
         self.execution_order.clear();
+        self.alias_plan = AliasPlan::default();
+        self.schedule = QueueSchedule::default();
         self.next_pass_id = 0;
         self.compiled = false;
     }
 }
+
+fn push_sync_point(
+    sync_points: &mut Vec<SyncPoint>,
+    signal_pass: PassId,
+    signal_queue: QueueClass,
+    wait_pass: PassId,
+    wait_queue: QueueClass,
+    resource: ResourceId,
+) {
+    if sync_points
+        .iter()
+        .any(|sp| sp.signal_pass == signal_pass && sp.wait_pass == wait_pass)
+    {
+        return;
+    }
+    sync_points.push(SyncPoint {
+        signal_pass,
+        signal_queue,
+        wait_pass,
+        wait_queue,
+        resource,
+    });
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn transient(graph: &mut FrameGraph, name: &str) -> ResourceId {
+        graph.create_resource(name, ResourceType::RenderTarget, 1920, 1080, ResourceFormat::RGBA16F)
+    }
+
+    #[test]
+    fn disjoint_transients_share_a_block() {
+        let mut graph = FrameGraph::new();
+        let a = transient(&mut graph, "bloom_half");
+        let b = transient(&mut graph, "ssgi_temp");
+
+        // a lives in passes 0-1, b only in pass 2 → lifetimes don't overlap.
+        graph.pass("p0").write(a).order(0).build();
+        graph.pass("p1").read(a).order(1).build();
+        graph.pass("p2").write(b).order(2).build();
+        graph.compile();
+
+        let plan = graph.alias_plan();
+        assert_eq!(plan.block_sizes.len(), 1);
+        assert_eq!(plan.bytes_allocated, plan.bytes_requested / 2);
+        assert!(graph
+            .barriers()
+            .iter()
+            .any(|bar| matches!(bar.kind, BarrierKind::Alias { previous } if previous == a)
+                && bar.resource == b));
+    }
+
+    #[test]
+    fn overlapping_transients_get_separate_blocks() {
+        let mut graph = FrameGraph::new();
+        let a = transient(&mut graph, "gbuffer_normal");
+        let b = transient(&mut graph, "gbuffer_albedo");
+
+        // Both alive in pass 1.
+        graph.pass("p0").writes(&[a, b]).order(0).build();
+        graph.pass("p1").reads(&[a, b]).order(1).build();
+        graph.compile();
+
+        let plan = graph.alias_plan();
+        assert_eq!(plan.block_sizes.len(), 2);
+        assert_eq!(plan.bytes_allocated, plan.bytes_requested);
+        assert!(!graph
+            .barriers()
+            .iter()
+            .any(|bar| matches!(bar.kind, BarrierKind::Alias { .. })));
+    }
+
+    #[test]
+    fn async_compute_overlaps_and_syncs_at_the_join() {
+        let mut graph = FrameGraph::new();
+        let shadow_map = transient(&mut graph, "shadow_map");
+        let hiz = transient(&mut graph, "hiz_pyramid");
+        let depth = transient(&mut graph, "depth");
+
+        // Hi-Z build runs on async compute while the shadow raster runs on
+        // graphics; lighting joins both results.
+        graph.pass("depth_prepass").write(depth).order(0).build();
+        graph.pass("shadow_raster").write(shadow_map).order(1).build();
+        graph
+            .pass("hiz_build")
+            .read(depth)
+            .write(hiz)
+            .order(1)
+            .on_async_compute()
+            .build();
+        graph
+            .pass("lighting")
+            .reads(&[shadow_map, hiz])
+            .order(2)
+            .build();
+        graph.compile();
+
+        let schedule = graph.schedule();
+        assert_eq!(schedule.graphics.len(), 3);
+        assert_eq!(schedule.async_compute.len(), 1);
+
+        // depth crosses graphics→compute, hiz crosses compute→graphics.
+        assert_eq!(schedule.sync_points.len(), 2);
+        assert!(schedule.sync_points.iter().any(|sp| {
+            sp.signal_queue == QueueClass::Graphics
+                && sp.wait_queue == QueueClass::AsyncCompute
+                && sp.resource == depth
+        }));
+        assert!(schedule.sync_points.iter().any(|sp| {
+            sp.signal_queue == QueueClass::AsyncCompute
+                && sp.wait_queue == QueueClass::Graphics
+                && sp.resource == hiz
+        }));
+    }
+
+    #[test]
+    fn same_queue_dependencies_need_no_sync_points() {
+        let mut graph = FrameGraph::new();
+        let a = transient(&mut graph, "scene_color");
+        graph.pass("p0").write(a).order(0).build();
+        graph.pass("p1").read(a).order(1).build();
+        graph.compile();
+
+        assert!(graph.schedule().sync_points.is_empty());
+        assert_eq!(graph.schedule().graphics.len(), 2);
+        assert!(graph.schedule().async_compute.is_empty());
+    }
+
+    #[test]
+    fn persistent_resources_are_never_aliased() {
+        let mut graph = FrameGraph::new();
+        let history = graph.create_persistent_resource(
+            "taa_history",
+            ResourceType::RenderTarget,
+            1920,
+            1080,
+            ResourceFormat::RGBA16F,
+        );
+        graph.pass("p0").write(history).order(0).build();
+        graph.compile();
+        assert!(graph.alias_plan().allocations.is_empty());
+    }
+}
@@ -5,7 +5,8 @@ mod types;
 
 pub use graph::FrameGraph;
 pub use types::{
-    AccessType, Barrier, FrameGraphStats, PassDesc, PassId, ResourceDesc, ResourceFormat,
-    ResourceId, ResourceType,
+    AccessType, AliasPlan, AliasedAllocation, Barrier, BarrierKind, FrameGraphStats, PassDesc,
+    PassId, QueueClass, QueueSchedule, ResourceDesc, ResourceFormat, ResourceId, ResourceType,
+    SyncPoint,
 };
 pub use presets::{create_deferred_graph, create_forward_graph};
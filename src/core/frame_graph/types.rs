@@ -38,6 +38,20 @@ pub enum ResourceFormat {
     Depth24Stencil8,
 }
 
+impl ResourceFormat {
+    /// Bytes per pixel, used to size transients for memory aliasing.
+    pub fn bytes_per_pixel(self) -> u64 {
+        match self {
+            ResourceFormat::R8 => 1,
+            ResourceFormat::R16F => 2,
+            ResourceFormat::RGBA8 | ResourceFormat::R32F | ResourceFormat::Depth32F => 4,
+            ResourceFormat::Depth24Stencil8 => 4,
+            ResourceFormat::RGBA16F => 8,
+            ResourceFormat::RGBA32F => 16,
+        }
+    }
+}
+
 #[derive(Clone, Copy, Debug, PartialEq, Eq)]
 pub enum AccessType {
     Read,
@@ -51,6 +65,15 @@ pub struct PassDependency {
     pub access: AccessType,
 }
 
+/// Queue a pass is scheduled on.
+#[derive(Clone, Copy, Debug, Default, PartialEq, Eq, Hash)]
+pub enum QueueClass {
+    #[default]
+    Graphics,
+    /// Dedicated compute queue (falls back to graphics on single-queue GPUs).
+    AsyncCompute,
+}
+
 #[derive(Clone, Debug)]
 pub struct PassDesc {
     pub id: PassId,
@@ -59,6 +82,17 @@ pub struct PassDesc {
     pub writes: Vec<ResourceId>,
     pub enabled: bool,
     pub order: i32,
+    pub queue: QueueClass,
+}
+
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum BarrierKind {
+    /// Ordinary write→read hazard between two passes.
+    Transition,
+    /// Memory aliasing: `resource` reuses memory previously occupied by
+    /// `previous`; the executor must make the old contents' writes visible
+    /// before the new resource is first written.
+    Alias { previous: ResourceId },
 }
 
 #[derive(Clone, Debug)]
@@ -68,6 +102,55 @@ pub struct Barrier {
     pub to_pass: PassId,
     pub from_access: AccessType,
     pub to_access: AccessType,
+    pub kind: BarrierKind,
+}
+
+/// Placement of one transient inside a shared memory block.
+#[derive(Clone, Debug)]
+pub struct AliasedAllocation {
+    pub resource: ResourceId,
+    /// Index into [`AliasPlan::block_sizes`].
+    pub block: u32,
+    pub size: u64,
+    /// First/last position in the execution order where the resource is used.
+    pub first_use: u32,
+    pub last_use: u32,
+}
+
+/// Result of transient lifetime analysis: which memory block each transient
+/// lives in. Resources in the same block have disjoint lifetimes; the
+/// executor backs each block with one gpu-allocator allocation sized to the
+/// largest occupant.
+#[derive(Clone, Debug, Default)]
+pub struct AliasPlan {
+    pub block_sizes: Vec<u64>,
+    pub allocations: Vec<AliasedAllocation>,
+    /// Sum of all transient sizes (what non-aliased allocation would cost).
+    pub bytes_requested: u64,
+    /// Sum of block sizes (what the plan actually needs).
+    pub bytes_allocated: u64,
+}
+
+/// Cross-queue dependency: `wait_pass` must not start until `signal_pass`
+/// has finished on the other queue. The executor maps each sync point to a
+/// semaphore signal/wait pair at submit time.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub struct SyncPoint {
+    pub signal_pass: PassId,
+    pub signal_queue: QueueClass,
+    pub wait_pass: PassId,
+    pub wait_queue: QueueClass,
+    pub resource: ResourceId,
+}
+
+/// Dual-queue schedule produced by `FrameGraph::compile()`. Per-queue pass
+/// lists preserve the global execution order, so intra-queue dependencies
+/// stay implicit; only cross-queue edges need semaphores.
+#[derive(Clone, Debug, Default)]
+pub struct QueueSchedule {
+    pub graphics: Vec<PassId>,
+    pub async_compute: Vec<PassId>,
+    pub sync_points: Vec<SyncPoint>,
 }
 
 #[derive(Clone, Debug, Default)]
@@ -77,4 +160,8 @@ pub struct FrameGraphStats {
     pub total_resources: u32,
     pub transient_resources: u32,
     pub barriers_generated: u32,
+    pub alias_blocks: u32,
+    pub alias_bytes_saved: u64,
+    pub async_compute_passes: u32,
+    pub queue_sync_points: u32,
 }
@@ -0,0 +1,392 @@
+// =============================================================================
+// REACTOR GPU Profiler — vkCmdWriteTimestamp-based Pass Timing
+// =============================================================================
+// Wraps command-buffer work (typically frame-graph passes) in timestamp query
+// pairs and resolves them with the frames-in-flight machinery: each in-flight
+// frame owns a query pool, and a slot's results are read back when the slot
+// is reused, i.e. after its fence has signalled, so resolution never stalls.
+//
+// Results feed `PerfCounter`s (one per scope name) for the HUD and can be
+// exported, merged with CPU spans, as chrome://tracing JSON.
+//
+// Usage per frame:
+//   profiler.begin_frame(cmd, frame_index);
+//   let scope = profiler.begin_scope(cmd, pass.name.clone());
+//   // ... record pass ...
+//   profiler.end_scope(cmd, scope);
+//
+// =============================================================================
+
+use std::collections::HashMap;
+use std::time::Instant;
+
+use ash::vk;
+
+use crate::core::context::VulkanContext;
+use crate::core::error::{ErrorCode, ReactorError, ReactorResult};
+use crate::core::profiler::PerfCounter;
+
+/// Handle for an open GPU scope, returned by [`GpuProfiler::begin_scope`].
+#[derive(Clone, Copy, Debug)]
+pub struct GpuScopeId(u32);
+
+/// One resolved GPU scope from a completed frame.
+#[derive(Clone, Debug)]
+pub struct GpuSpan {
+    pub name: String,
+    /// Start in nanoseconds on the GPU clock, relative to the first
+    /// timestamp the profiler ever resolved.
+    pub start_ns: u64,
+    pub duration_ms: f64,
+}
+
+struct FrameSlot {
+    pool: vk::QueryPool,
+    /// Scope names for this slot; scope `i` owns queries `2i` / `2i + 1`.
+    scopes: Vec<String>,
+    pending: bool,
+}
+
+pub struct GpuProfiler {
+    device: ash::Device,
+    slots: Vec<FrameSlot>,
+    /// Slot currently being recorded (set by `begin_frame`).
+    current: usize,
+    max_scopes: u32,
+    /// Nanoseconds per timestamp tick (`timestampPeriod`).
+    timestamp_period: f64,
+    /// GPU tick of the first resolved timestamp, used as the trace origin.
+    gpu_origin: Option<u64>,
+    counters: HashMap<String, PerfCounter>,
+    last_frame: Vec<GpuSpan>,
+    trace: ChromeTrace,
+}
+
+impl GpuProfiler {
+    /// Create a profiler with one query pool per in-flight frame.
+    ///
+    /// Fails with `ErrorCode::ResourceLimit` if the queue family does not
+    /// support timestamps (`timestampValidBits == 0` would make every read
+    /// garbage).
+    pub fn new(
+        ctx: &VulkanContext,
+        frames_in_flight: usize,
+        max_scopes_per_frame: u32,
+    ) -> ReactorResult<Self> {
+        let properties = unsafe {
+            ctx.ash_instance()
+                .get_physical_device_properties(ctx.physical_device)
+        };
+        if properties.limits.timestamp_compute_and_graphics == vk::FALSE {
+            return Err(ReactorError::new(
+                ErrorCode::ResourceLimit,
+                "GPU timestamps not supported on all graphics/compute queues",
+            ));
+        }
+
+        let device = ctx.ash_device().clone();
+        let pool_info = vk::QueryPoolCreateInfo::default()
+            .query_type(vk::QueryType::TIMESTAMP)
+            .query_count(max_scopes_per_frame * 2);
+
+        let mut slots = Vec::with_capacity(frames_in_flight);
+        for _ in 0..frames_in_flight {
+            let pool = unsafe { device.create_query_pool(&pool_info, None)? };
+            slots.push(FrameSlot {
+                pool,
+                scopes: Vec::new(),
+                pending: false,
+            });
+        }
+
+        Ok(Self {
+            device,
+            slots,
+            current: 0,
+            max_scopes: max_scopes_per_frame,
+            timestamp_period: properties.limits.timestamp_period as f64,
+            gpu_origin: None,
+            counters: HashMap::new(),
+            last_frame: Vec::new(),
+            trace: ChromeTrace::new(),
+        })
+    }
+
+    /// Resolve the slot's previous results (its fence has signalled by the
+    /// time the frame index comes around again), then reset the pool for this
+    /// frame's queries. Call first thing after `vkBeginCommandBuffer`.
+    pub fn begin_frame(&mut self, cmd: vk::CommandBuffer, frame_index: usize) {
+        self.resolve_slot(frame_index);
+
+        let slot = &mut self.slots[frame_index];
+        slot.scopes.clear();
+        slot.pending = true;
+        self.current = frame_index;
+        unsafe {
+            self.device
+                .cmd_reset_query_pool(cmd, slot.pool, 0, self.max_scopes * 2);
+        }
+    }
+
+    /// Open a named GPU scope. The timestamp lands when all prior commands
+    /// reach the top of the pipe.
+    pub fn begin_scope(&mut self, cmd: vk::CommandBuffer, name: String) -> Option<GpuScopeId> {
+        let slot = &mut self.slots[self.current];
+        if slot.scopes.len() as u32 >= self.max_scopes {
+            tracing::warn!(
+                target: "reactor::gpu_profiler",
+                scope = %name,
+                "GPU profiler scope budget exhausted; scope dropped"
+            );
+            return None;
+        }
+        let index = slot.scopes.len() as u32;
+        slot.scopes.push(name);
+        unsafe {
+            self.device.cmd_write_timestamp(
+                cmd,
+                vk::PipelineStageFlags::TOP_OF_PIPE,
+                slot.pool,
+                index * 2,
+            );
+        }
+        Some(GpuScopeId(index))
+    }
+
+    /// Close a scope; the timestamp lands once all its commands retire.
+    pub fn end_scope(&mut self, cmd: vk::CommandBuffer, scope: Option<GpuScopeId>) {
+        let Some(GpuScopeId(index)) = scope else { return };
+        let slot = &self.slots[self.current];
+        unsafe {
+            self.device.cmd_write_timestamp(
+                cmd,
+                vk::PipelineStageFlags::BOTTOM_OF_PIPE,
+                slot.pool,
+                index * 2 + 1,
+            );
+        }
+    }
+
+    fn resolve_slot(&mut self, frame_index: usize) {
+        let slot = &mut self.slots[frame_index];
+        if !slot.pending || slot.scopes.is_empty() {
+            slot.pending = false;
+            return;
+        }
+        slot.pending = false;
+
+        let query_count = slot.scopes.len() * 2;
+        let mut ticks = vec![0u64; query_count];
+        // The slot's fence signalled before the frame index was reused, so
+        // WAIT never actually blocks here.
+        let result = unsafe {
+            self.device.get_query_pool_results(
+                slot.pool,
+                0,
+                &mut ticks,
+                vk::QueryResultFlags::TYPE_64 | vk::QueryResultFlags::WAIT,
+            )
+        };
+        if result.is_err() {
+            return;
+        }
+
+        let origin = *self.gpu_origin.get_or_insert(ticks[0]);
+        self.last_frame.clear();
+
+        for (i, name) in slot.scopes.iter().enumerate() {
+            let begin = ticks[i * 2];
+            let end = ticks[i * 2 + 1];
+            if end <= begin {
+                continue;
+            }
+            let duration_ms = (end - begin) as f64 * self.timestamp_period / 1_000_000.0;
+            let start_ns =
+                (begin.saturating_sub(origin) as f64 * self.timestamp_period) as u64;
+
+            self.counters
+                .entry(name.clone())
+                .or_insert_with(|| PerfCounter::new("gpu_pass_ms"))
+                .push(duration_ms);
+            self.trace.push_gpu_span(
+                name,
+                start_ns as f64 / 1_000.0,
+                duration_ms * 1_000.0,
+            );
+            self.last_frame.push(GpuSpan {
+                name: name.clone(),
+                start_ns,
+                duration_ms,
+            });
+        }
+    }
+
+    /// Spans from the most recently resolved frame.
+    pub fn last_frame(&self) -> &[GpuSpan] {
+        &self.last_frame
+    }
+
+    /// Rolling per-scope statistics (milliseconds), keyed by scope name.
+    pub fn counters(&self) -> &HashMap<String, PerfCounter> {
+        &self.counters
+    }
+
+    /// Record a CPU span into the merged trace (microseconds since
+    /// [`ChromeTrace`] creation). Use [`ChromeTrace::now_us`] for timestamps.
+    pub fn trace_mut(&mut self) -> &mut ChromeTrace {
+        &mut self.trace
+    }
+
+    /// Write the merged CPU+GPU trace as chrome://tracing JSON.
+    pub fn export_chrome_trace(&self, path: &std::path::Path) -> ReactorResult<()> {
+        self.trace.save(path)
+    }
+
+    pub fn destroy(&mut self) {
+        unsafe {
+            for slot in &self.slots {
+                self.device.destroy_query_pool(slot.pool, None);
+            }
+        }
+        self.slots.clear();
+    }
+}
+
+// =============================================================================
+// Chrome tracing export
+// =============================================================================
+
+/// Accumulates CPU and GPU spans and serializes them in the chrome://tracing
+/// "trace event" format (open via chrome://tracing or https://ui.perfetto.dev).
+///
+/// CPU and GPU clocks are not calibrated against each other; spans land on
+/// separate tracks (`tid` 0 = CPU, 1 = GPU) with each clock starting at its
+/// own origin, which is enough to see per-pass cost and queue gaps.
+pub struct ChromeTrace {
+    events: Vec<TraceEvent>,
+    epoch: Instant,
+}
+
+struct TraceEvent {
+    name: String,
+    category: &'static str,
+    ts_us: f64,
+    dur_us: f64,
+    tid: u32,
+}
+
+/// Keep at most this many events to bound memory during long sessions.
+const TRACE_EVENT_CAP: usize = 256 * 1024;
+
+impl ChromeTrace {
+    pub fn new() -> Self {
+        Self {
+            events: Vec::new(),
+            epoch: Instant::now(),
+        }
+    }
+
+    /// Microseconds since this trace was created (CPU clock).
+    pub fn now_us(&self) -> f64 {
+        self.epoch.elapsed().as_secs_f64() * 1_000_000.0
+    }
+
+    pub fn push_cpu_span(&mut self, name: &str, ts_us: f64, dur_us: f64) {
+        self.push(name, "cpu", ts_us, dur_us, 0);
+    }
+
+    pub fn push_gpu_span(&mut self, name: &str, ts_us: f64, dur_us: f64) {
+        self.push(name, "gpu", ts_us, dur_us, 1);
+    }
+
+    fn push(&mut self, name: &str, category: &'static str, ts_us: f64, dur_us: f64, tid: u32) {
+        if self.events.len() >= TRACE_EVENT_CAP {
+            return;
+        }
+        self.events.push(TraceEvent {
+            name: name.to_string(),
+            category,
+            ts_us,
+            dur_us,
+            tid,
+        });
+    }
+
+    pub fn len(&self) -> usize {
+        self.events.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.events.is_empty()
+    }
+
+    pub fn clear(&mut self) {
+        self.events.clear();
+    }
+
+    /// Serialize as a JSON array of complete ("ph": "X") events.
+    pub fn save(&self, path: &std::path::Path) -> ReactorResult<()> {
+        let events: Vec<serde_json::Value> = self
+            .events
+            .iter()
+            .map(|e| {
+                serde_json::json!({
+                    "name": e.name,
+                    "cat": e.category,
+                    "ph": "X",
+                    "ts": e.ts_us,
+                    "dur": e.dur_us,
+                    "pid": 0,
+                    "tid": e.tid,
+                })
+            })
+            .collect();
+        let json = serde_json::to_string(&events).map_err(|e| {
+            ReactorError::new(ErrorCode::IoError, format!("trace serialization: {e}"))
+        })?;
+        std::fs::write(path, json)?;
+        Ok(())
+    }
+}
+
+impl Default for ChromeTrace {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn chrome_trace_roundtrips_through_json() {
+        let mut trace = ChromeTrace::new();
+        trace.push_cpu_span("update", 0.0, 1500.0);
+        trace.push_gpu_span("shadow_raster", 100.0, 1800.0);
+
+        let path = std::env::temp_dir().join("reactor_trace_test.json");
+        trace.save(&path).unwrap();
+
+        let json: serde_json::Value =
+            serde_json::from_str(&std::fs::read_to_string(&path).unwrap()).unwrap();
+        let events = json.as_array().unwrap();
+        assert_eq!(events.len(), 2);
+        assert_eq!(events[0]["name"], "update");
+        assert_eq!(events[0]["ph"], "X");
+        assert_eq!(events[1]["cat"], "gpu");
+        assert_eq!(events[1]["tid"], 1);
+        let _ = std::fs::remove_file(&path);
+    }
+
+    #[test]
+    fn trace_buffer_is_bounded() {
+        let mut trace = ChromeTrace::new();
+        for i in 0..8 {
+            trace.push_cpu_span("span", i as f64, 1.0);
+        }
+        assert_eq!(trace.len(), 8);
+        trace.clear();
+        assert!(trace.is_empty());
+    }
+}
@@ -8,10 +8,19 @@
 // - Importancia audio (spatial audio detail)
 //
 // Un solo concepto, múltiples sistemas.
+//
+// Almacenamiento SoA: los 4 canales viven empaquetados en `[f32; 4]` por tile
+// (decay y combine se vectorizan) y los pases por tile corren en chunks sobre
+// el job system. `next_frame()` es incremental: un mapa quieto (sin updates y
+// con el decay ya convergido a cero) no toca ningún tile.
 // =============================================================================
 
+use std::sync::atomic::{AtomicBool, Ordering};
+
 use glam::Vec3;
 
+use crate::core::jobs;
+
 /// Tipo de importancia
 #[derive(Clone, Copy, Debug, PartialEq, Eq)]
 pub enum ImportanceType {
@@ -66,7 +75,10 @@ impl Default for ImportanceMapConfig {
     }
 }
 
-/// Datos de un tile de importancia
+/// Snapshot de un tile de importancia.
+///
+/// El almacenamiento interno es SoA; este struct es la vista AoS que se
+/// entrega a los consumidores (shadow scheduling, VRS, etc.).
 #[derive(Clone, Debug, Default)]
 pub struct ImportanceTileData {
     /// Importancia visual (0-1)
@@ -105,43 +117,66 @@ impl ImportanceTileData {
 
     /// Obtener nivel de detalle sugerido (0 = máximo, 3 = mínimo)
     pub fn suggested_lod(&self) -> u8 {
-        if self.combined > 0.75 {
-            0
-        } else if self.combined > 0.5 {
-            1
-        } else if self.combined > 0.25 {
-            2
-        } else {
-            3
-        }
+        suggested_lod(self.combined)
     }
 
     /// Obtener frecuencia de actualización sugerida (cada N frames)
     pub fn suggested_update_frequency(&self) -> u32 {
-        if self.combined > 0.75 {
-            1
-        }
-        // Cada frame
-        else if self.combined > 0.5 {
-            2
-        }
-        // Cada 2 frames
-        else if self.combined > 0.25 {
-            4
-        }
-        // Cada 4 frames
-        else {
-            8
-        } // Cada 8 frames
+        suggested_update_frequency(self.combined)
+    }
+}
+
+fn suggested_lod(combined: f32) -> u8 {
+    if combined > 0.75 {
+        0
+    } else if combined > 0.5 {
+        1
+    } else if combined > 0.25 {
+        2
+    } else {
+        3
     }
 }
 
+fn suggested_update_frequency(combined: f32) -> u32 {
+    if combined > 0.75 {
+        1 // Cada frame
+    } else if combined > 0.5 {
+        2 // Cada 2 frames
+    } else if combined > 0.25 {
+        4 // Cada 4 frames
+    } else {
+        8 // Cada 8 frames
+    }
+}
+
+/// Tiles por chunk en los pases paralelos.
+const TILE_CHUNK: usize = 2048;
+/// Canal por debajo de este valor se considera extinguido por el decay.
+const QUIESCENT_EPSILON: f32 = 1e-4;
+/// Delta de cámara que dispara un refresco de importancia visual.
+const CAMERA_EPSILON: f32 = 1e-4;
+
 /// Importance Map Universal
 pub struct ImportanceMap {
     /// Configuración
     pub config: ImportanceMapConfig,
-    /// Datos de tiles
-    tiles: Vec<ImportanceTileData>,
+    // ── Almacenamiento SoA ────────────────────────────────────────────
+    /// Canales [visual, physics, ai, audio] por tile.
+    channels: Vec<[f32; 4]>,
+    combined: Vec<f32>,
+    world_center: Vec<Vec3>,
+    camera_distance: Vec<f32>,
+    visible: Vec<bool>,
+    last_update_frame: Vec<u64>,
+    /// Tiles cuyos inputs cambiaron este frame (no reciben decay).
+    updated: Vec<bool>,
+    // ── Estado incremental ────────────────────────────────────────────
+    any_updated: bool,
+    /// Mientras algún canal siga por encima de epsilon, el decay corre.
+    needs_decay: bool,
+    combined_dirty: bool,
+    last_camera: Option<(Vec3, Vec3)>,
     /// Frame actual
     current_frame: u64,
     /// Estadísticas
@@ -177,25 +212,26 @@ impl ImportanceMap {
             ..Default::default()
         };
 
-        let total_tiles = (tile_width * tile_height) as usize;
-        let tiles = vec![ImportanceTileData::default(); total_tiles];
-
-        Self {
-            config,
-            tiles,
-            current_frame: 0,
-            stats: ImportanceMapStats::default(),
-        }
+        Self::with_config(config)
     }
 
     /// Crear con configuración personalizada
     pub fn with_config(config: ImportanceMapConfig) -> Self {
         let total_tiles = (config.tile_width * config.tile_height) as usize;
-        let tiles = vec![ImportanceTileData::default(); total_tiles];
 
         Self {
             config,
-            tiles,
+            channels: vec![[0.0; 4]; total_tiles],
+            combined: vec![0.0; total_tiles],
+            world_center: vec![Vec3::ZERO; total_tiles],
+            camera_distance: vec![0.0; total_tiles],
+            visible: vec![false; total_tiles],
+            last_update_frame: vec![0; total_tiles],
+            updated: vec![false; total_tiles],
+            any_updated: false,
+            needs_decay: false,
+            combined_dirty: false,
+            last_camera: None,
             current_frame: 0,
             stats: ImportanceMapStats::default(),
         }
@@ -210,57 +246,58 @@ impl ImportanceMap {
         }
     }
 
-    /// Obtener tile en coordenadas
-    pub fn get_tile(&self, x: u32, y: u32) -> Option<&ImportanceTileData> {
-        self.tile_index(x, y).map(|i| &self.tiles[i])
-    }
-
-    /// Obtener tile mutable
-    pub fn get_tile_mut(&mut self, x: u32, y: u32) -> Option<&mut ImportanceTileData> {
-        self.tile_index(x, y).map(|i| &mut self.tiles[i])
+    /// Snapshot del tile en coordenadas (vista AoS del almacenamiento SoA).
+    pub fn get_tile(&self, x: u32, y: u32) -> Option<ImportanceTileData> {
+        self.tile_index(x, y).map(|i| ImportanceTileData {
+            visual: self.channels[i][0],
+            physics: self.channels[i][1],
+            ai: self.channels[i][2],
+            audio: self.channels[i][3],
+            combined: self.combined[i],
+            world_center: self.world_center[i],
+            camera_distance: self.camera_distance[i],
+            visible: self.visible[i],
+            last_update_frame: self.last_update_frame[i],
+        })
     }
 
-    /// Obtener tile desde coordenadas de pantalla
-    pub fn get_tile_at_screen(&self, screen_x: u32, screen_y: u32) -> Option<&ImportanceTileData> {
+    /// Snapshot del tile desde coordenadas de pantalla.
+    pub fn get_tile_at_screen(&self, screen_x: u32, screen_y: u32) -> Option<ImportanceTileData> {
         let tile_x = screen_x / self.config.tile_size;
         let tile_y = screen_y / self.config.tile_size;
         self.get_tile(tile_x, tile_y)
     }
 
-    /// Establecer importancia visual para un tile
-    pub fn set_visual_importance(&mut self, x: u32, y: u32, importance: f32) {
+    fn set_channel(&mut self, x: u32, y: u32, channel: usize, importance: f32) {
         let current_frame = self.current_frame;
         if let Some(idx) = self.tile_index(x, y) {
-            self.tiles[idx].visual = importance.clamp(0.0, 1.0);
-            self.tiles[idx].last_update_frame = current_frame;
+            self.channels[idx][channel] = importance.clamp(0.0, 1.0);
+            self.last_update_frame[idx] = current_frame;
+            self.updated[idx] = true;
+            self.any_updated = true;
+            self.needs_decay = true;
+            self.combined_dirty = true;
         }
     }
 
+    /// Establecer importancia visual para un tile
+    pub fn set_visual_importance(&mut self, x: u32, y: u32, importance: f32) {
+        self.set_channel(x, y, 0, importance);
+    }
+
     /// Establecer importancia física para un tile
     pub fn set_physics_importance(&mut self, x: u32, y: u32, importance: f32) {
-        let current_frame = self.current_frame;
-        if let Some(idx) = self.tile_index(x, y) {
-            self.tiles[idx].physics = importance.clamp(0.0, 1.0);
-            self.tiles[idx].last_update_frame = current_frame;
-        }
+        self.set_channel(x, y, 1, importance);
     }
 
     /// Establecer importancia AI para un tile
     pub fn set_ai_importance(&mut self, x: u32, y: u32, importance: f32) {
-        let current_frame = self.current_frame;
-        if let Some(idx) = self.tile_index(x, y) {
-            self.tiles[idx].ai = importance.clamp(0.0, 1.0);
-            self.tiles[idx].last_update_frame = current_frame;
-        }
+        self.set_channel(x, y, 2, importance);
     }
 
     /// Establecer importancia audio para un tile
     pub fn set_audio_importance(&mut self, x: u32, y: u32, importance: f32) {
-        let current_frame = self.current_frame;
-        if let Some(idx) = self.tile_index(x, y) {
-            self.tiles[idx].audio = importance.clamp(0.0, 1.0);
-            self.tiles[idx].last_update_frame = current_frame;
-        }
+        self.set_channel(x, y, 3, importance);
     }
 
     /// Establecer todas las importancias de un tile
@@ -275,97 +312,213 @@ impl ImportanceMap {
     ) {
         let current_frame = self.current_frame;
         if let Some(idx) = self.tile_index(x, y) {
-            self.tiles[idx].visual = visual.clamp(0.0, 1.0);
-            self.tiles[idx].physics = physics.clamp(0.0, 1.0);
-            self.tiles[idx].ai = ai.clamp(0.0, 1.0);
-            self.tiles[idx].audio = audio.clamp(0.0, 1.0);
-            self.tiles[idx].last_update_frame = current_frame;
+            self.channels[idx] = [
+                visual.clamp(0.0, 1.0),
+                physics.clamp(0.0, 1.0),
+                ai.clamp(0.0, 1.0),
+                audio.clamp(0.0, 1.0),
+            ];
+            self.last_update_frame[idx] = current_frame;
+            self.updated[idx] = true;
+            self.any_updated = true;
+            self.needs_decay = true;
+            self.combined_dirty = true;
         }
     }
 
-    /// Actualizar importancia basada en posición de cámara
+    /// Establecer el centro en world space de un tile (necesario para
+    /// `update_from_camera`).
+    pub fn set_world_center(&mut self, x: u32, y: u32, center: Vec3) {
+        if let Some(idx) = self.tile_index(x, y) {
+            self.world_center[idx] = center;
+        }
+    }
+
+    /// Actualizar importancia basada en posición de cámara.
+    ///
+    /// Incremental: si la cámara no se movió ni rotó desde la última llamada
+    /// (delta < epsilon), no se toca ningún tile.
     pub fn update_from_camera(&mut self, camera_pos: Vec3, camera_forward: Vec3) {
-        for tile in &mut self.tiles {
-            if tile.world_center != Vec3::ZERO {
-                // Calcular distancia
-                tile.camera_distance = (tile.world_center - camera_pos).length();
+        if let Some((last_pos, last_forward)) = self.last_camera {
+            if (last_pos - camera_pos).length_squared() < CAMERA_EPSILON * CAMERA_EPSILON
+                && (last_forward - camera_forward).length_squared()
+                    < CAMERA_EPSILON * CAMERA_EPSILON
+            {
+                return;
+            }
+        }
+        self.last_camera = Some((camera_pos, camera_forward));
+
+        // Distancias a cámara.
+        jobs::par_chunks_zip_mut(
+            &self.world_center,
+            &mut self.camera_distance,
+            TILE_CHUNK,
+            |centers, distances| {
+                for (center, distance) in centers.iter().zip(distances.iter_mut()) {
+                    if *center != Vec3::ZERO {
+                        *distance = (*center - camera_pos).length();
+                    }
+                }
+            },
+        );
 
-                // Importancia visual basada en distancia
-                let dist_factor = 1.0 / (tile.camera_distance * 0.1 + 1.0);
+        // Importancia visual por distancia + alineación con la vista.
+        jobs::par_chunks_zip_mut(
+            &self.world_center,
+            &mut self.channels,
+            TILE_CHUNK,
+            |centers, channels| {
+                for (center, ch) in centers.iter().zip(channels.iter_mut()) {
+                    if *center != Vec3::ZERO {
+                        let to_tile = *center - camera_pos;
+                        let distance = to_tile.length();
+                        let dist_factor = 1.0 / (distance * 0.1 + 1.0);
+                        let view_factor =
+                            camera_forward.dot(to_tile / distance.max(1e-6)).max(0.0);
+                        ch[0] = (dist_factor * 0.5 + view_factor * 0.5).clamp(0.0, 1.0);
+                    }
+                }
+            },
+        );
 
-                // Importancia basada en dirección de vista
-                let to_tile = (tile.world_center - camera_pos).normalize();
-                let view_factor = camera_forward.dot(to_tile).max(0.0);
+        // Los tiles refrescados por cámara no reciben decay este frame.
+        jobs::par_chunks_zip_mut(
+            &self.world_center,
+            &mut self.updated,
+            TILE_CHUNK,
+            |centers, updated| {
+                for (center, up) in centers.iter().zip(updated.iter_mut()) {
+                    if *center != Vec3::ZERO {
+                        *up = true;
+                    }
+                }
+            },
+        );
 
-                tile.visual = (dist_factor * 0.5 + view_factor * 0.5).clamp(0.0, 1.0);
-            }
-        }
+        self.any_updated = true;
+        self.needs_decay = true;
+        self.combined_dirty = true;
     }
 
     /// Actualizar importancia desde visibilidad (frustum culling)
     pub fn update_visibility(&mut self, visible_tiles: &[(u32, u32)]) {
-        // Marcar todos como no visibles
-        for tile in &mut self.tiles {
-            tile.visible = false;
-        }
-
-        // Marcar visibles
+        self.visible.fill(false);
         for &(x, y) in visible_tiles {
-            if let Some(tile) = self.get_tile_mut(x, y) {
-                tile.visible = true;
+            if let Some(idx) = self.tile_index(x, y) {
+                self.visible[idx] = true;
             }
         }
+        self.combined_dirty = true;
     }
 
-    /// Recalcular importancia combinada de todos los tiles
+    /// Recalcular importancia combinada de todos los tiles.
+    ///
+    /// Producto punto `canales · pesos` por tile, en chunks paralelos.
     pub fn recalculate_combined(&mut self) {
-        for tile in &mut self.tiles {
-            tile.calculate_combined(&self.config);
-        }
+        let weights = [
+            self.config.visual_weight,
+            self.config.physics_weight,
+            self.config.ai_weight,
+            self.config.audio_weight,
+        ];
+        jobs::par_chunks_zip_mut(
+            &self.channels,
+            &mut self.combined,
+            TILE_CHUNK,
+            |channels, combined| {
+                for (ch, out) in channels.iter().zip(combined.iter_mut()) {
+                    *out = ch[0] * weights[0]
+                        + ch[1] * weights[1]
+                        + ch[2] * weights[2]
+                        + ch[3] * weights[3];
+                }
+            },
+        );
+        self.combined_dirty = false;
     }
 
-    /// Aplicar decaimiento temporal
+    /// Aplicar decaimiento temporal a los tiles no actualizados este frame.
+    ///
+    /// Los canales que caen bajo epsilon se fijan en cero; cuando todos los
+    /// tiles llegan ahí, el mapa queda quieto y `next_frame()` deja de pagar
+    /// este pase.
     pub fn apply_temporal_decay(&mut self) {
         let decay = self.config.temporal_decay;
-        for tile in &mut self.tiles {
-            // Si no se actualizó este frame, aplicar decay
-            if tile.last_update_frame < self.current_frame {
-                tile.visual *= decay;
-                tile.physics *= decay;
-                tile.ai *= decay;
-                tile.audio *= decay;
-            }
-        }
+        let still_active = AtomicBool::new(false);
+
+        jobs::par_chunks_zip_mut(
+            &self.updated,
+            &mut self.channels,
+            TILE_CHUNK,
+            |updated, channels| {
+                let mut active = false;
+                for (up, ch) in updated.iter().zip(channels.iter_mut()) {
+                    if *up {
+                        active = true;
+                        continue;
+                    }
+                    ch[0] *= decay;
+                    ch[1] *= decay;
+                    ch[2] *= decay;
+                    ch[3] *= decay;
+                    if ch.iter().any(|v| *v > QUIESCENT_EPSILON) {
+                        active = true;
+                    } else {
+                        *ch = [0.0; 4];
+                    }
+                }
+                if active {
+                    still_active.store(true, Ordering::Relaxed);
+                }
+            },
+        );
+
+        self.needs_decay = still_active.load(Ordering::Relaxed);
+        self.combined_dirty = true;
     }
 
-    /// Avanzar frame
+    /// Avanzar frame.
+    ///
+    /// Solo paga los pases cuyos inputs cambiaron: decay mientras queden
+    /// canales vivos, combine/stats cuando algo se tocó. Un mapa quieto no
+    /// recorre ningún tile.
     pub fn next_frame(&mut self) {
         self.current_frame += 1;
-        self.apply_temporal_decay();
-        self.recalculate_combined();
-        self.update_stats();
+
+        if self.needs_decay {
+            self.apply_temporal_decay();
+        }
+        if self.combined_dirty {
+            self.recalculate_combined();
+            self.update_stats();
+        }
+        if self.any_updated {
+            self.updated.fill(false);
+            self.any_updated = false;
+        }
     }
 
     /// Actualizar estadísticas
     fn update_stats(&mut self) {
-        self.stats.total_tiles = self.tiles.len() as u32;
-        self.stats.visible_tiles = self.tiles.iter().filter(|t| t.visible).count() as u32;
-        self.stats.important_tiles = self
-            .tiles
-            .iter()
-            .filter(|t| t.is_important(self.config.importance_threshold))
-            .count() as u32;
-
-        let sum: f32 = self.tiles.iter().map(|t| t.combined).sum();
-        self.stats.average_importance = sum / self.tiles.len() as f32;
-
-        self.stats.lod_distribution = [0; 4];
-        for tile in &self.tiles {
-            let lod = tile.suggested_lod() as usize;
-            if lod < 4 {
-                self.stats.lod_distribution[lod] += 1;
+        self.stats.total_tiles = self.combined.len() as u32;
+        self.stats.visible_tiles = self.visible.iter().filter(|v| **v).count() as u32;
+
+        let threshold = self.config.importance_threshold;
+        let mut important = 0u32;
+        let mut sum = 0.0f32;
+        let mut lod_distribution = [0u32; 4];
+        for &combined in &self.combined {
+            if combined >= threshold {
+                important += 1;
             }
+            sum += combined;
+            lod_distribution[suggested_lod(combined) as usize] += 1;
         }
+
+        self.stats.important_tiles = important;
+        self.stats.average_importance = sum / self.combined.len().max(1) as f32;
+        self.stats.lod_distribution = lod_distribution;
     }
 
     /// Obtener importancia en coordenadas de pantalla
@@ -375,13 +528,15 @@ impl ImportanceMap {
         screen_y: u32,
         importance_type: ImportanceType,
     ) -> f32 {
-        if let Some(tile) = self.get_tile_at_screen(screen_x, screen_y) {
+        let tile_x = screen_x / self.config.tile_size;
+        let tile_y = screen_y / self.config.tile_size;
+        if let Some(idx) = self.tile_index(tile_x, tile_y) {
             match importance_type {
-                ImportanceType::Visual => tile.visual,
-                ImportanceType::Physics => tile.physics,
-                ImportanceType::AI => tile.ai,
-                ImportanceType::Audio => tile.audio,
-                ImportanceType::Combined => tile.combined,
+                ImportanceType::Visual => self.channels[idx][0],
+                ImportanceType::Physics => self.channels[idx][1],
+                ImportanceType::AI => self.channels[idx][2],
+                ImportanceType::Audio => self.channels[idx][3],
+                ImportanceType::Combined => self.combined[idx],
             }
         } else {
             0.0
@@ -390,8 +545,10 @@ impl ImportanceMap {
 
     /// Verificar si un objeto debe actualizarse este frame
     pub fn should_update(&self, screen_x: u32, screen_y: u32) -> bool {
-        if let Some(tile) = self.get_tile_at_screen(screen_x, screen_y) {
-            let freq = tile.suggested_update_frequency();
+        let tile_x = screen_x / self.config.tile_size;
+        let tile_y = screen_y / self.config.tile_size;
+        if let Some(idx) = self.tile_index(tile_x, tile_y) {
+            let freq = suggested_update_frequency(self.combined[idx]);
             (self.current_frame % freq as u64) == 0
         } else {
             true // Por defecto, actualizar
@@ -400,8 +557,10 @@ impl ImportanceMap {
 
     /// Obtener LOD sugerido para una posición
     pub fn get_suggested_lod(&self, screen_x: u32, screen_y: u32) -> u8 {
-        if let Some(tile) = self.get_tile_at_screen(screen_x, screen_y) {
-            tile.suggested_lod()
+        let tile_x = screen_x / self.config.tile_size;
+        let tile_y = screen_y / self.config.tile_size;
+        if let Some(idx) = self.tile_index(tile_x, tile_y) {
+            suggested_lod(self.combined[idx])
         } else {
             0 // Máximo detalle por defecto
         }
@@ -414,7 +573,17 @@ impl ImportanceMap {
             (screen_height + self.config.tile_size - 1) / self.config.tile_size;
 
         let total_tiles = (self.config.tile_width * self.config.tile_height) as usize;
-        self.tiles = vec![ImportanceTileData::default(); total_tiles];
+        self.channels = vec![[0.0; 4]; total_tiles];
+        self.combined = vec![0.0; total_tiles];
+        self.world_center = vec![Vec3::ZERO; total_tiles];
+        self.camera_distance = vec![0.0; total_tiles];
+        self.visible = vec![false; total_tiles];
+        self.last_update_frame = vec![0; total_tiles];
+        self.updated = vec![false; total_tiles];
+        self.any_updated = false;
+        self.needs_decay = false;
+        self.combined_dirty = false;
+        self.last_camera = None;
     }
 
     /// Imprimir estadísticas
@@ -439,15 +608,6 @@ impl ImportanceMap {
             self.stats.average_importance
         );
         println!("║ LOD Distribution:                                                ║");
-        println!(
-            "║ Important Tiles: {:5}                                            ║",
-            self.stats.important_tiles
-        );
-        println!(
-            "║ Avg Importance:  {:5.2}                                          ║",
-            self.stats.average_importance
-        );
-        println!("║ LOD Distribution:                                                ║");
         println!(
             "║   LOD 0 (Max):   {:5}                                            ║",
             self.stats.lod_distribution[0]
@@ -473,3 +633,58 @@ impl Default for ImportanceMap {
         Self::new(1920, 1080)
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn combined_matches_channel_weights() {
+        let mut map = ImportanceMap::new(256, 256);
+        map.set_tile_importance(2, 3, 1.0, 0.5, 0.0, 0.0);
+        map.next_frame();
+
+        let tile = map.get_tile(2, 3).unwrap();
+        let expected =
+            1.0 * map.config.visual_weight + 0.5 * map.config.physics_weight;
+        assert!((tile.combined - expected).abs() < 1e-6);
+    }
+
+    #[test]
+    fn decay_converges_to_quiescence() {
+        let mut map = ImportanceMap::new(256, 256);
+        map.set_visual_importance(1, 1, 1.0);
+        map.next_frame();
+
+        // Sin nuevos inputs el decay apaga el tile por completo.
+        for _ in 0..100 {
+            map.next_frame();
+        }
+        assert_eq!(map.get_importance_at(16, 16, ImportanceType::Visual), 0.0);
+        assert_eq!(map.get_importance_at(16, 16, ImportanceType::Combined), 0.0);
+        assert!(!map.needs_decay);
+    }
+
+    #[test]
+    fn static_camera_skips_the_update() {
+        let mut map = ImportanceMap::new(256, 256);
+        map.set_world_center(0, 0, Vec3::new(0.0, 0.0, -10.0));
+
+        map.update_from_camera(Vec3::ZERO, Vec3::NEG_Z);
+        map.next_frame();
+        let first = map.get_tile(0, 0).unwrap().visual;
+        assert!(first > 0.0);
+
+        // Misma cámara: la llamada retorna sin marcar nada y el decay sigue
+        // bajando la importancia visual.
+        map.update_from_camera(Vec3::ZERO, Vec3::NEG_Z);
+        map.next_frame();
+        let second = map.get_tile(0, 0).unwrap().visual;
+        assert!(second < first);
+
+        // Cámara movida: el tile se refresca a su valor completo.
+        map.update_from_camera(Vec3::new(1.0, 0.0, 0.0), Vec3::NEG_Z);
+        map.next_frame();
+        assert!(map.get_tile(0, 0).unwrap().visual > second);
+    }
+}
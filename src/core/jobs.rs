@@ -135,6 +135,41 @@ where
     slice.par_chunks_mut(chunk_size).for_each(body);
 }
 
+/// Execute a closure over matching chunks of two parallel slices (read-only).
+/// Both slices must be the same length; chunk `i` of `keys` lines up with
+/// chunk `i` of `values`. Used by the ECS to walk entity-id and component
+/// arrays together.
+#[inline]
+pub fn par_chunks_zip<'a, A, B, F>(keys: &'a [A], values: &'a [B], chunk_size: usize, body: F)
+where
+    A: Sync + 'a,
+    B: Sync + 'a,
+    F: Fn(&[A], &[B]) + Send + Sync,
+{
+    debug_assert_eq!(keys.len(), values.len());
+    init_job_system();
+    keys.par_chunks(chunk_size)
+        .zip(values.par_chunks(chunk_size))
+        .for_each(|(k, v)| body(k, v));
+}
+
+/// Execute a closure over matching chunks of two parallel slices, mutating
+/// the second. Rayon splits `values` into disjoint `&mut` chunks, so each
+/// invocation of `body` owns its slice exclusively.
+#[inline]
+pub fn par_chunks_zip_mut<'a, A, B, F>(keys: &'a [A], values: &'a mut [B], chunk_size: usize, body: F)
+where
+    A: Sync + 'a,
+    B: Send + 'a,
+    F: Fn(&[A], &mut [B]) + Send + Sync,
+{
+    debug_assert_eq!(keys.len(), values.len());
+    init_job_system();
+    keys.par_chunks(chunk_size)
+        .zip(values.par_chunks_mut(chunk_size))
+        .for_each(|(k, v)| body(k, v));
+}
+
 // =============================================================================
 // Scoped tasks (guaranteed completion)
 // =============================================================================
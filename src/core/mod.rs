@@ -28,6 +28,10 @@ pub mod error;
 /// Use `profile_scope!("name")` to instrument any scope.
 pub mod profiler;
 
+/// GPU timestamp profiler (vkCmdWriteTimestamp per frame-graph pass,
+/// chrome://tracing export).
+pub mod gpu_profiler;
+
 /// Structured logging (tracing-subscriber, env-filter via `REACTOR_LOG`).
 pub mod logging;
 
@@ -51,8 +55,8 @@ pub use debug_utils::DebugNamer;
 pub use device::DeviceInfo;
 pub use error::{ErrorCode, ReactorError, ReactorResult};
 pub use frame_graph::{
-    Barrier, FrameGraph, FrameGraphStats, PassDesc, PassId, ResourceFormat, ResourceId,
-    ResourceType,
+    AliasPlan, Barrier, BarrierKind, FrameGraph, FrameGraphStats, PassDesc, PassId, QueueClass,
+    QueueSchedule, ResourceFormat, ResourceId, ResourceType, SyncPoint,
 };
 pub use importance_map::{
     ImportanceMap, ImportanceMapConfig, ImportanceMapStats, ImportanceTileData, ImportanceType,
@@ -64,13 +68,17 @@ pub use vrs::{
 };
 
 // Profiler
+pub use gpu_profiler::{ChromeTrace, GpuProfiler, GpuScopeId, GpuSpan};
 pub use profiler::{begin_frame, get_frame_id, CpuTimer, PerfCounter};
 
 // Logging
 pub use logging::{init_logger, init_logger_with, LogLevel};
 
 // Jobs
-pub use jobs::{init_job_system, join, par_iter, par_iter_mut, parallel_for, scope};
+pub use jobs::{
+    init_job_system, join, par_chunks_zip, par_chunks_zip_mut, par_iter, par_iter_mut,
+    parallel_for, scope,
+};
 
 // Allocators
 pub use linear_allocator::{BumpArena, LinearAllocator};
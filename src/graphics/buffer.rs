@@ -22,7 +22,19 @@ impl Buffer {
         usage: vk::BufferUsageFlags,
         location: MemoryLocation,
     ) -> ReactorResult<Self> {
-        let device = ctx.ash_device();
+        Self::from_device(&ctx.device, allocator, size, usage, location)
+    }
+
+    /// Create from an `ArcDevice` directly — for helpers that outlive the
+    /// borrow of a `VulkanContext` (batch builders, worker threads).
+    pub fn from_device(
+        arc_device: &ArcDevice,
+        allocator: Arc<Mutex<Allocator>>,
+        size: u64,
+        usage: vk::BufferUsageFlags,
+        location: MemoryLocation,
+    ) -> ReactorResult<Self> {
+        let device = arc_device.get();
         let create_info = vk::BufferCreateInfo::default()
             .size(size)
             .usage(usage)
@@ -73,7 +85,7 @@ impl Buffer {
             handle,
             allocation: Some(allocation),
             size,
-            device: ctx.device.clone(),
+            device: arc_device.clone(),
             allocator,
         })
     }
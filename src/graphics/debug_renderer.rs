@@ -1,4 +1,14 @@
+use ash::vk;
+use bytemuck::{Pod, Zeroable};
 use glam::{Mat4, Vec3, Vec4};
+use gpu_allocator::vulkan::Allocator;
+use gpu_allocator::MemoryLocation;
+use std::sync::{Arc, Mutex};
+
+use crate::core::error::ReactorResult;
+use crate::core::VulkanContext;
+use crate::graphics::buffer::Buffer;
+use crate::reactor::MAX_FRAMES_IN_FLIGHT;
 
 /// Simple AABB for debug rendering
 #[derive(Clone, Copy, Debug)]
@@ -55,12 +65,190 @@ impl DebugLine {
     }
 }
 
+/// Vertex layout for debug lines (position + color, line-list topology).
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Pod, Zeroable)]
+pub struct DebugVertex {
+    pub position: [f32; 3],
+    pub color: [f32; 4],
+}
+
+/// Per-instance data for instanced debug shapes: one unit mesh (cube or
+/// sphere circles), transform + color per instance. 10k broadphase boxes
+/// are one instanced draw instead of 120k CPU-tessellated line vertices.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Pod, Zeroable)]
+pub struct DebugShapeInstance {
+    pub transform: [[f32; 4]; 4],
+    pub color: [f32; 4],
+}
+
+/// Persistently-mapped vertex ring with one region per frame in flight.
+/// `push` writes straight into the mapped region for the current frame —
+/// no intermediate Vec, no per-frame buffer creation or upload copy. The
+/// region rotation means the GPU can still be reading frame N-1's region
+/// while the CPU fills frame N's.
+pub struct DebugRing<T: Pod> {
+    buffer: Buffer,
+    /// Capacity of a single frame region, in elements.
+    capacity: usize,
+    frame: usize,
+    cursor: usize,
+    dropped: usize,
+    _marker: std::marker::PhantomData<T>,
+}
+
+impl<T: Pod> DebugRing<T> {
+    pub fn new(
+        ctx: &VulkanContext,
+        allocator: Arc<Mutex<Allocator>>,
+        capacity_per_frame: usize,
+    ) -> ReactorResult<Self> {
+        let size = (capacity_per_frame * MAX_FRAMES_IN_FLIGHT * std::mem::size_of::<T>()) as u64;
+        let buffer = Buffer::new(
+            ctx,
+            allocator,
+            size,
+            vk::BufferUsageFlags::VERTEX_BUFFER,
+            MemoryLocation::CpuToGpu,
+        )?;
+        Ok(Self {
+            buffer,
+            capacity: capacity_per_frame,
+            frame: 0,
+            cursor: 0,
+            dropped: 0,
+            _marker: std::marker::PhantomData,
+        })
+    }
+
+    /// Rotate to the region owned by `frame_index` and reset the cursor.
+    pub fn begin_frame(&mut self, frame_index: usize) {
+        self.frame = frame_index % MAX_FRAMES_IN_FLIGHT;
+        self.clear_frame();
+    }
+
+    pub fn clear_frame(&mut self) {
+        self.cursor = 0;
+        self.dropped = 0;
+    }
+
+    pub fn push(&mut self, value: T) {
+        if self.cursor >= self.capacity {
+            self.dropped += 1;
+            return;
+        }
+        if let Some(ptr) = self.buffer.map::<T>() {
+            unsafe {
+                ptr.add(self.frame * self.capacity + self.cursor).write(value);
+            }
+            self.cursor += 1;
+        }
+    }
+
+    /// Buffer handle + byte offset of the current frame region, for
+    /// `cmd_bind_vertex_buffers`.
+    pub fn binding(&self) -> (vk::Buffer, vk::DeviceSize) {
+        let offset = (self.frame * self.capacity * std::mem::size_of::<T>()) as vk::DeviceSize;
+        (self.buffer.handle, offset)
+    }
+
+    /// Elements written into the current frame region.
+    pub fn len(&self) -> usize {
+        self.cursor
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.cursor == 0
+    }
+
+    /// Elements dropped this frame because the region was full.
+    pub fn dropped(&self) -> usize {
+        self.dropped
+    }
+}
+
+/// GPU-side buffers for the debug renderer: a line vertex ring plus one
+/// instance ring per shape kind. Draw code binds `lines.binding()` for the
+/// line pass and `boxes`/`spheres` as the instance stream over the unit
+/// meshes from [`unit_cube_edges`]/[`unit_sphere_edges`].
+pub struct DebugGpuBuffers {
+    pub lines: DebugRing<DebugVertex>,
+    pub boxes: DebugRing<DebugShapeInstance>,
+    pub spheres: DebugRing<DebugShapeInstance>,
+}
+
+/// Per-frame instance capacity for each shape ring (boxes, spheres).
+pub const DEBUG_SHAPE_CAPACITY: usize = 16384;
+
+/// Unit cube edge list (line-list topology), centered at the origin with
+/// half-extent 0.5; the per-instance transform scales it to the AABB.
+pub fn unit_cube_edges() -> [[f32; 3]; 24] {
+    const H: f32 = 0.5;
+    let corners = [
+        [-H, -H, -H],
+        [H, -H, -H],
+        [H, -H, H],
+        [-H, -H, H],
+        [-H, H, -H],
+        [H, H, -H],
+        [H, H, H],
+        [-H, H, H],
+    ];
+    const EDGES: [(usize, usize); 12] = [
+        (0, 1),
+        (1, 2),
+        (2, 3),
+        (3, 0),
+        (4, 5),
+        (5, 6),
+        (6, 7),
+        (7, 4),
+        (0, 4),
+        (1, 5),
+        (2, 6),
+        (3, 7),
+    ];
+    let mut out = [[0.0; 3]; 24];
+    for (i, (a, b)) in EDGES.iter().enumerate() {
+        out[i * 2] = corners[*a];
+        out[i * 2 + 1] = corners[*b];
+    }
+    out
+}
+
+/// Three great circles (XY/XZ/YZ) of a unit-radius sphere as a line list;
+/// the per-instance transform scales by the radius.
+pub fn unit_sphere_edges(segments: u32) -> Vec<[f32; 3]> {
+    let segments = segments.max(8);
+    let step = std::f32::consts::TAU / segments as f32;
+    let mut out = Vec::with_capacity(segments as usize * 6);
+    for i in 0..segments {
+        let a1 = i as f32 * step;
+        let a2 = (i + 1) as f32 * step;
+        out.push([a1.cos(), a1.sin(), 0.0]);
+        out.push([a2.cos(), a2.sin(), 0.0]);
+        out.push([a1.cos(), 0.0, a1.sin()]);
+        out.push([a2.cos(), 0.0, a2.sin()]);
+        out.push([0.0, a1.cos(), a1.sin()]);
+        out.push([0.0, a2.cos(), a2.sin()]);
+    }
+    out
+}
+
 /// Debug renderer for visualizing shapes, rays, etc.
+///
+/// By default draws accumulate into CPU line lists (`get_lines`). With
+/// [`attach_gpu`](Self::attach_gpu) the `line`/`aabb`/`sphere` calls write
+/// directly into persistently-mapped ring buffers instead, and AABBs and
+/// spheres become instances over shared unit meshes rather than being
+/// tessellated into lines on the CPU.
 pub struct DebugRenderer {
     lines: Vec<DebugLine>,
     persistent_lines: Vec<DebugLine>,
     enabled: bool,
     max_lines: usize,
+    gpu: Option<DebugGpuBuffers>,
 }
 
 impl DebugRenderer {
@@ -70,6 +258,48 @@ impl DebugRenderer {
             persistent_lines: Vec::new(),
             enabled: true,
             max_lines: 10000,
+            gpu: None,
+        }
+    }
+
+    /// Switch to the GPU path: line draws write into a persistently-mapped
+    /// per-frame-in-flight vertex ring, AABBs/spheres into instance rings.
+    pub fn attach_gpu(
+        &mut self,
+        ctx: &VulkanContext,
+        allocator: Arc<Mutex<Allocator>>,
+    ) -> ReactorResult<()> {
+        self.gpu = Some(DebugGpuBuffers {
+            lines: DebugRing::new(ctx, allocator.clone(), self.max_lines * 2)?,
+            boxes: DebugRing::new(ctx, allocator.clone(), DEBUG_SHAPE_CAPACITY)?,
+            spheres: DebugRing::new(ctx, allocator, DEBUG_SHAPE_CAPACITY)?,
+        });
+        Ok(())
+    }
+
+    pub fn gpu(&self) -> Option<&DebugGpuBuffers> {
+        self.gpu.as_ref()
+    }
+
+    /// Per-frame reset. With GPU buffers attached this rotates the rings to
+    /// the frame-in-flight region and replays persistent lines into the new
+    /// region; without them it just clears the transient CPU list.
+    pub fn begin_frame(&mut self, frame_index: usize) {
+        self.lines.clear();
+        if let Some(gpu) = self.gpu.as_mut() {
+            gpu.lines.begin_frame(frame_index);
+            gpu.boxes.begin_frame(frame_index);
+            gpu.spheres.begin_frame(frame_index);
+            for line in &self.persistent_lines {
+                gpu.lines.push(DebugVertex {
+                    position: line.start.to_array(),
+                    color: line.color.to_array(),
+                });
+                gpu.lines.push(DebugVertex {
+                    position: line.end.to_array(),
+                    color: line.color.to_array(),
+                });
+            }
         }
     }
 
@@ -83,6 +313,11 @@ impl DebugRenderer {
 
     pub fn clear(&mut self) {
         self.lines.clear();
+        if let Some(gpu) = self.gpu.as_mut() {
+            gpu.lines.clear_frame();
+            gpu.boxes.clear_frame();
+            gpu.spheres.clear_frame();
+        }
     }
 
     pub fn clear_persistent(&mut self) {
@@ -90,15 +325,39 @@ impl DebugRenderer {
     }
 
     pub fn line(&mut self, start: Vec3, end: Vec3, color: Vec4) {
-        if self.enabled && self.lines.len() < self.max_lines {
+        if !self.enabled {
+            return;
+        }
+        if let Some(gpu) = self.gpu.as_mut() {
+            gpu.lines.push(DebugVertex {
+                position: start.to_array(),
+                color: color.to_array(),
+            });
+            gpu.lines.push(DebugVertex {
+                position: end.to_array(),
+                color: color.to_array(),
+            });
+        } else if self.lines.len() < self.max_lines {
             self.lines.push(DebugLine::new(start, end, color));
         }
     }
 
     pub fn line_persistent(&mut self, start: Vec3, end: Vec3, color: Vec4) {
-        if self.enabled && self.persistent_lines.len() < self.max_lines {
-            self.persistent_lines
-                .push(DebugLine::new(start, end, color));
+        if !(self.enabled && self.persistent_lines.len() < self.max_lines) {
+            return;
+        }
+        self.persistent_lines
+            .push(DebugLine::new(start, end, color));
+        // Also visible this frame; begin_frame replays it from then on.
+        if let Some(gpu) = self.gpu.as_mut() {
+            gpu.lines.push(DebugVertex {
+                position: start.to_array(),
+                color: color.to_array(),
+            });
+            gpu.lines.push(DebugVertex {
+                position: end.to_array(),
+                color: color.to_array(),
+            });
         }
     }
 
@@ -107,6 +366,20 @@ impl DebugRenderer {
     }
 
     pub fn aabb(&mut self, aabb: &DebugAABB, color: Vec4) {
+        if !self.enabled {
+            return;
+        }
+        // GPU path: one instance over the unit cube instead of 12 lines.
+        if let Some(gpu) = self.gpu.as_mut() {
+            let transform = Mat4::from_translation((aabb.min + aabb.max) * 0.5)
+                * Mat4::from_scale(aabb.max - aabb.min);
+            gpu.boxes.push(DebugShapeInstance {
+                transform: transform.to_cols_array_2d(),
+                color: color.to_array(),
+            });
+            return;
+        }
+
         let min = aabb.min;
         let max = aabb.max;
 
@@ -178,6 +451,21 @@ impl DebugRenderer {
     }
 
     pub fn sphere(&mut self, sphere: &DebugSphere, color: Vec4, segments: u32) {
+        if !self.enabled {
+            return;
+        }
+        // GPU path: one instance over the unit sphere circles; `segments`
+        // only applies to the CPU fallback (the unit mesh is fixed).
+        if let Some(gpu) = self.gpu.as_mut() {
+            let transform = Mat4::from_translation(sphere.center)
+                * Mat4::from_scale(Vec3::splat(sphere.radius));
+            gpu.spheres.push(DebugShapeInstance {
+                transform: transform.to_cols_array_2d(),
+                color: color.to_array(),
+            });
+            return;
+        }
+
         let segments = segments.max(8);
         let step = std::f32::consts::TAU / segments as f32;
 
@@ -311,7 +599,11 @@ impl DebugRenderer {
     }
 
     pub fn line_count(&self) -> usize {
-        self.lines.len() + self.persistent_lines.len()
+        if let Some(gpu) = &self.gpu {
+            gpu.lines.len() / 2
+        } else {
+            self.lines.len() + self.persistent_lines.len()
+        }
     }
 }
 
@@ -320,3 +612,42 @@ impl Default for DebugRenderer {
         Self::new()
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_unit_cube_edges_span_half_extents() {
+        let edges = unit_cube_edges();
+        assert_eq!(edges.len(), 24); // 12 edges, line-list
+        for v in edges {
+            for c in v {
+                assert!((c.abs() - 0.5).abs() < f32::EPSILON);
+            }
+        }
+    }
+
+    #[test]
+    fn test_unit_sphere_edges_are_unit_radius() {
+        let edges = unit_sphere_edges(16);
+        assert_eq!(edges.len(), 16 * 6); // 3 circles, line-list
+        for v in edges {
+            let len = (v[0] * v[0] + v[1] * v[1] + v[2] * v[2]).sqrt();
+            assert!((len - 1.0).abs() < 1e-5);
+        }
+    }
+
+    #[test]
+    fn test_cpu_fallback_still_tessellates() {
+        let mut debug = DebugRenderer::new();
+        debug.aabb(
+            &DebugAABB {
+                min: Vec3::ZERO,
+                max: Vec3::ONE,
+            },
+            Vec4::ONE,
+        );
+        assert_eq!(debug.line_count(), 12);
+    }
+}
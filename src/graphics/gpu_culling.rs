@@ -0,0 +1,409 @@
+//! GPU-driven culling — frustum + Hi-Z occlusion in compute
+//!
+//! Wraps `shaders/compute/cull.comp`. Per frame the pass reads an SSBO of
+//! object bounds (`GpuObjectAabb`, layout-compatible with `ObjectAABB` in the
+//! shader), tests each object against the six frustum planes and the Hi-Z
+//! depth pyramid, and compacts survivors into a `VkDrawIndexedIndirectCommand`
+//! buffer plus an atomic draw count. The raster side then consumes both with
+//! `vkCmdDrawIndexedIndirectCount`, so CPU cost no longer scales with
+//! candidate count.
+//!
+//! Typical frame:
+//! 1. `update_objects()` — upload this frame's candidate bounds (CPU write).
+//! 2. `record()` — zero the count, dispatch the cull, barrier to indirect.
+//! 3. `draw()` — one `cmd_draw_indexed_indirect_count` for all survivors.
+
+use crate::compute::ComputePipeline;
+use crate::core::error::ReactorResult;
+use crate::core::VulkanContext;
+use crate::graphics::{Buffer, HiZPyramid};
+use crate::systems::frustum::Frustum;
+use ash::vk;
+use bytemuck::{Pod, Zeroable};
+use glam::{Mat4, Vec3};
+use gpu_allocator::vulkan::Allocator;
+use gpu_allocator::MemoryLocation;
+use std::sync::{Arc, Mutex};
+
+/// Layout-compatible with `ObjectAABB` in `cull.comp`. 48 bytes.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default, Pod, Zeroable)]
+pub struct GpuObjectAabb {
+    /// xyz = world-space center, w = bounding-sphere radius.
+    pub center_radius: [f32; 4],
+    /// xyz = AABB half-extents, w = flags (bit 0 = visible).
+    pub extent_flags: [f32; 4],
+    pub mesh_index: u32,
+    pub index_count: u32,
+    pub first_index: u32,
+    pub vertex_offset: i32,
+}
+
+/// `CullPushConstants` in `cull.comp`. 192 bytes.
+const CULL_PUSH_SIZE: u32 = 192;
+/// `local_size_x` in `cull.comp`.
+const CULL_GROUP_SIZE: u32 = 64;
+/// `VkDrawIndexedIndirectCommand` stride written by the shader.
+const DRAW_COMMAND_STRIDE: u32 = 20;
+
+pub struct GpuCullingPass {
+    device: ash::Device,
+    pipeline: Option<ComputePipeline>,
+    descriptor_layout: vk::DescriptorSetLayout,
+    descriptor_pool: vk::DescriptorPool,
+    descriptor_sets: Vec<vk::DescriptorSet>,
+    object_buffer: Buffer,
+    command_buffer: Buffer,
+    count_buffer: Buffer,
+    capacity: u32,
+    object_count: u32,
+}
+
+impl GpuCullingPass {
+    pub fn new(
+        ctx: &VulkanContext,
+        allocator: Arc<Mutex<Allocator>>,
+        image_count: u32,
+        max_objects: u32,
+    ) -> ReactorResult<Self> {
+        let device = ctx.ash_device().clone();
+
+        let bindings = [
+            vk::DescriptorSetLayoutBinding::default()
+                .binding(0)
+                .descriptor_type(vk::DescriptorType::STORAGE_BUFFER)
+                .descriptor_count(1)
+                .stage_flags(vk::ShaderStageFlags::COMPUTE),
+            vk::DescriptorSetLayoutBinding::default()
+                .binding(1)
+                .descriptor_type(vk::DescriptorType::STORAGE_BUFFER)
+                .descriptor_count(1)
+                .stage_flags(vk::ShaderStageFlags::COMPUTE),
+            vk::DescriptorSetLayoutBinding::default()
+                .binding(2)
+                .descriptor_type(vk::DescriptorType::STORAGE_BUFFER)
+                .descriptor_count(1)
+                .stage_flags(vk::ShaderStageFlags::COMPUTE),
+            vk::DescriptorSetLayoutBinding::default()
+                .binding(3)
+                .descriptor_type(vk::DescriptorType::COMBINED_IMAGE_SAMPLER)
+                .descriptor_count(1)
+                .stage_flags(vk::ShaderStageFlags::COMPUTE),
+        ];
+        let layout_info = vk::DescriptorSetLayoutCreateInfo::default()
+            .bindings(&bindings)
+            .flags(vk::DescriptorSetLayoutCreateFlags::UPDATE_AFTER_BIND_POOL);
+        let descriptor_layout =
+            unsafe { device.create_descriptor_set_layout(&layout_info, None)? };
+
+        let spv = ash::util::read_spv(&mut std::io::Cursor::new(include_bytes!(
+            "../../shaders/compute/cull.spv"
+        )))?;
+        let pipeline =
+            ComputePipeline::new(ctx, &spv, &[descriptor_layout], Some(CULL_PUSH_SIZE))?;
+
+        let object_buffer = Buffer::new(
+            ctx,
+            allocator.clone(),
+            max_objects as u64 * std::mem::size_of::<GpuObjectAabb>() as u64,
+            vk::BufferUsageFlags::STORAGE_BUFFER,
+            MemoryLocation::CpuToGpu,
+        )?;
+        let command_buffer = Buffer::new(
+            ctx,
+            allocator.clone(),
+            max_objects as u64 * DRAW_COMMAND_STRIDE as u64,
+            vk::BufferUsageFlags::STORAGE_BUFFER | vk::BufferUsageFlags::INDIRECT_BUFFER,
+            MemoryLocation::GpuOnly,
+        )?;
+        let count_buffer = Buffer::new(
+            ctx,
+            allocator.clone(),
+            4,
+            vk::BufferUsageFlags::STORAGE_BUFFER
+                | vk::BufferUsageFlags::INDIRECT_BUFFER
+                | vk::BufferUsageFlags::TRANSFER_DST,
+            MemoryLocation::GpuOnly,
+        )?;
+
+        let pool_sizes = [
+            vk::DescriptorPoolSize::default()
+                .ty(vk::DescriptorType::STORAGE_BUFFER)
+                .descriptor_count(image_count * 3),
+            vk::DescriptorPoolSize::default()
+                .ty(vk::DescriptorType::COMBINED_IMAGE_SAMPLER)
+                .descriptor_count(image_count),
+        ];
+        let pool_info = vk::DescriptorPoolCreateInfo::default()
+            .pool_sizes(&pool_sizes)
+            .max_sets(image_count)
+            .flags(vk::DescriptorPoolCreateFlags::UPDATE_AFTER_BIND);
+        let descriptor_pool = unsafe { device.create_descriptor_pool(&pool_info, None)? };
+
+        let layouts = vec![descriptor_layout; image_count as usize];
+        let alloc_info = vk::DescriptorSetAllocateInfo::default()
+            .descriptor_pool(descriptor_pool)
+            .set_layouts(&layouts);
+        let descriptor_sets = unsafe { device.allocate_descriptor_sets(&alloc_info)? };
+
+        // The buffer bindings never change; only the Hi-Z view is rewritten
+        // each frame in `record()`.
+        for &set in &descriptor_sets {
+            let object_info = vk::DescriptorBufferInfo::default()
+                .buffer(object_buffer.handle)
+                .offset(0)
+                .range(vk::WHOLE_SIZE);
+            let command_info = vk::DescriptorBufferInfo::default()
+                .buffer(command_buffer.handle)
+                .offset(0)
+                .range(vk::WHOLE_SIZE);
+            let count_info = vk::DescriptorBufferInfo::default()
+                .buffer(count_buffer.handle)
+                .offset(0)
+                .range(4);
+            let writes = [
+                vk::WriteDescriptorSet::default()
+                    .dst_set(set)
+                    .dst_binding(0)
+                    .descriptor_type(vk::DescriptorType::STORAGE_BUFFER)
+                    .buffer_info(std::slice::from_ref(&object_info)),
+                vk::WriteDescriptorSet::default()
+                    .dst_set(set)
+                    .dst_binding(1)
+                    .descriptor_type(vk::DescriptorType::STORAGE_BUFFER)
+                    .buffer_info(std::slice::from_ref(&command_info)),
+                vk::WriteDescriptorSet::default()
+                    .dst_set(set)
+                    .dst_binding(2)
+                    .descriptor_type(vk::DescriptorType::STORAGE_BUFFER)
+                    .buffer_info(std::slice::from_ref(&count_info)),
+            ];
+            unsafe {
+                device.update_descriptor_sets(&writes, &[]);
+            }
+        }
+
+        Ok(Self {
+            device,
+            pipeline: Some(pipeline),
+            descriptor_layout,
+            descriptor_pool,
+            descriptor_sets,
+            object_buffer,
+            command_buffer,
+            count_buffer,
+            capacity: max_objects,
+            object_count: 0,
+        })
+    }
+
+    /// Upload this frame's cull candidates. Truncates at capacity.
+    pub fn update_objects(&mut self, objects: &[GpuObjectAabb]) {
+        let count = objects.len().min(self.capacity as usize);
+        if count > 0 {
+            self.object_buffer.write(&objects[..count]);
+        }
+        self.object_count = count as u32;
+    }
+
+    /// Record the culling dispatch. The Hi-Z pyramid for `image_index` must
+    /// already be built (`HiZPyramid::build`) earlier in this command buffer.
+    pub fn record(
+        &self,
+        command_buffer: vk::CommandBuffer,
+        image_index: usize,
+        view_proj: Mat4,
+        camera_pos: Vec3,
+        near_plane: f32,
+        hiz: &HiZPyramid,
+        sampler: vk::Sampler,
+    ) {
+        let Some(pipeline) = self.pipeline.as_ref() else {
+            return;
+        };
+        let Some(&set) = self.descriptor_sets.get(image_index) else {
+            return;
+        };
+        if self.object_count == 0 {
+            // Still zero the count so the indirect draw is a no-op, and make
+            // the TRANSFER write visible to the indirect-count read (the
+            // compute/draw barriers below only run on the non-empty path).
+            unsafe {
+                self.device
+                    .cmd_fill_buffer(command_buffer, self.count_buffer.handle, 0, 4, 0);
+                let zero_barrier = vk::BufferMemoryBarrier::default()
+                    .src_access_mask(vk::AccessFlags::TRANSFER_WRITE)
+                    .dst_access_mask(vk::AccessFlags::INDIRECT_COMMAND_READ)
+                    .src_queue_family_index(vk::QUEUE_FAMILY_IGNORED)
+                    .dst_queue_family_index(vk::QUEUE_FAMILY_IGNORED)
+                    .buffer(self.count_buffer.handle)
+                    .offset(0)
+                    .size(4);
+                self.device.cmd_pipeline_barrier(
+                    command_buffer,
+                    vk::PipelineStageFlags::TRANSFER,
+                    vk::PipelineStageFlags::DRAW_INDIRECT,
+                    vk::DependencyFlags::empty(),
+                    &[],
+                    &[zero_barrier],
+                    &[],
+                );
+            }
+            return;
+        }
+        let device = &self.device;
+
+        let hiz_info = vk::DescriptorImageInfo::default()
+            .image_layout(vk::ImageLayout::SHADER_READ_ONLY_OPTIMAL)
+            .image_view(hiz.images[image_index].view)
+            .sampler(sampler);
+        let hiz_write = vk::WriteDescriptorSet::default()
+            .dst_set(set)
+            .dst_binding(3)
+            .descriptor_type(vk::DescriptorType::COMBINED_IMAGE_SAMPLER)
+            .image_info(std::slice::from_ref(&hiz_info));
+        unsafe {
+            device.update_descriptor_sets(std::slice::from_ref(&hiz_write), &[]);
+        }
+
+        // Reset the atomic draw count before the dispatch reads it.
+        unsafe {
+            device.cmd_fill_buffer(command_buffer, self.count_buffer.handle, 0, 4, 0);
+        }
+        let reset_barrier = vk::BufferMemoryBarrier::default()
+            .src_access_mask(vk::AccessFlags::TRANSFER_WRITE)
+            .dst_access_mask(vk::AccessFlags::SHADER_READ | vk::AccessFlags::SHADER_WRITE)
+            .src_queue_family_index(vk::QUEUE_FAMILY_IGNORED)
+            .dst_queue_family_index(vk::QUEUE_FAMILY_IGNORED)
+            .buffer(self.count_buffer.handle)
+            .offset(0)
+            .size(4);
+        unsafe {
+            device.cmd_pipeline_barrier(
+                command_buffer,
+                vk::PipelineStageFlags::TRANSFER,
+                vk::PipelineStageFlags::COMPUTE_SHADER,
+                vk::DependencyFlags::empty(),
+                &[],
+                &[reset_barrier],
+                &[],
+            );
+        }
+
+        let frustum = Frustum::from_view_projection(view_proj);
+        let mut pb = [0u8; CULL_PUSH_SIZE as usize];
+        let mut o = 0usize;
+        for &v in &view_proj.to_cols_array() {
+            pb[o..o + 4].copy_from_slice(&v.to_ne_bytes());
+            o += 4;
+        }
+        for plane in &frustum.planes {
+            for v in [plane.normal.x, plane.normal.y, plane.normal.z, plane.distance] {
+                pb[o..o + 4].copy_from_slice(&v.to_ne_bytes());
+                o += 4;
+            }
+        }
+        for v in [camera_pos.x, camera_pos.y, camera_pos.z, 1.0f32] {
+            pb[o..o + 4].copy_from_slice(&v.to_ne_bytes());
+            o += 4;
+        }
+        pb[o..o + 4].copy_from_slice(&self.object_count.to_ne_bytes());
+        o += 4;
+        pb[o..o + 4].copy_from_slice(&(hiz.width as f32).to_ne_bytes());
+        o += 4;
+        pb[o..o + 4].copy_from_slice(&(hiz.height as f32).to_ne_bytes());
+        o += 4;
+        pb[o..o + 4].copy_from_slice(&near_plane.to_ne_bytes());
+
+        unsafe {
+            pipeline.bind(command_buffer, device);
+            device.cmd_bind_descriptor_sets(
+                command_buffer,
+                vk::PipelineBindPoint::COMPUTE,
+                pipeline.layout,
+                0,
+                &[set],
+                &[],
+            );
+            device.cmd_push_constants(
+                command_buffer,
+                pipeline.layout,
+                vk::ShaderStageFlags::COMPUTE,
+                0,
+                &pb,
+            );
+            let groups = (self.object_count + CULL_GROUP_SIZE - 1) / CULL_GROUP_SIZE;
+            device.cmd_dispatch(command_buffer, groups, 1, 1);
+        }
+
+        // Compacted commands + count must be visible to the indirect stage.
+        let barriers = [
+            vk::BufferMemoryBarrier::default()
+                .src_access_mask(vk::AccessFlags::SHADER_WRITE)
+                .dst_access_mask(vk::AccessFlags::INDIRECT_COMMAND_READ)
+                .src_queue_family_index(vk::QUEUE_FAMILY_IGNORED)
+                .dst_queue_family_index(vk::QUEUE_FAMILY_IGNORED)
+                .buffer(self.command_buffer.handle)
+                .offset(0)
+                .size(vk::WHOLE_SIZE),
+            vk::BufferMemoryBarrier::default()
+                .src_access_mask(vk::AccessFlags::SHADER_WRITE)
+                .dst_access_mask(vk::AccessFlags::INDIRECT_COMMAND_READ)
+                .src_queue_family_index(vk::QUEUE_FAMILY_IGNORED)
+                .dst_queue_family_index(vk::QUEUE_FAMILY_IGNORED)
+                .buffer(self.count_buffer.handle)
+                .offset(0)
+                .size(4),
+        ];
+        unsafe {
+            device.cmd_pipeline_barrier(
+                command_buffer,
+                vk::PipelineStageFlags::COMPUTE_SHADER,
+                vk::PipelineStageFlags::DRAW_INDIRECT,
+                vk::DependencyFlags::empty(),
+                &[],
+                &barriers,
+                &[],
+            );
+        }
+    }
+
+    /// Issue the survivors in one call. The caller binds pipeline, vertex and
+    /// index buffers first; `first_instance` of each command carries the
+    /// original object index for per-object data lookup.
+    pub fn draw(&self, command_buffer: vk::CommandBuffer) {
+        unsafe {
+            self.device.cmd_draw_indexed_indirect_count(
+                command_buffer,
+                self.command_buffer.handle,
+                0,
+                self.count_buffer.handle,
+                0,
+                self.capacity,
+                DRAW_COMMAND_STRIDE,
+            );
+        }
+    }
+
+    pub fn object_count(&self) -> u32 {
+        self.object_count
+    }
+
+    pub fn capacity(&self) -> u32 {
+        self.capacity
+    }
+
+    pub fn destroy(&mut self) {
+        self.descriptor_sets.clear();
+        self.pipeline = None;
+        unsafe {
+            self.object_buffer.destroy();
+            self.command_buffer.destroy();
+            self.count_buffer.destroy();
+            self.device
+                .destroy_descriptor_pool(self.descriptor_pool, None);
+            self.device
+                .destroy_descriptor_set_layout(self.descriptor_layout, None);
+        }
+    }
+}
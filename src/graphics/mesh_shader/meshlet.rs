@@ -1,76 +1,275 @@
+use glam::Vec3;
+
+use crate::core::error::{ReactorError, ReactorResult};
+use crate::resources::gltf_loader::GltfMeshData;
+
+/// Límites estándar por meshlet (EXT_mesh_shader friendly).
+pub const MESHLET_MAX_VERTICES: u32 = 64;
+pub const MESHLET_MAX_TRIANGLES: u32 = 124;
+
+/// Espeja el `struct Meshlet` std430 de meshlet.task/meshlet.mesh: cada
+/// `vec3` tiene alineación base de 16 bytes, de ahí los paddings explícitos
+/// tras cada uno (`cone_cutoff` empaqueta en los 4 bytes libres después de
+/// `cone_axis`, igual que en el shader). Stride: 96 bytes.
 #[repr(C)]
-#[derive(Debug, Clone, Copy, Default)]
+#[derive(Debug, Clone, Copy, Default, bytemuck::Pod, bytemuck::Zeroable)]
 pub struct Meshlet {
+    /// Offset en `MeshletMesh::vertex_indices` (índices al vertex buffer real).
     pub vertex_offset: u32,
     pub vertex_count: u32,
+    /// Offset en `MeshletMesh::triangle_indices` (índices locales de 8 bits).
     pub index_offset: u32,
     pub index_count: u32,
     pub aabb_min: [f32; 3],
+    pub _pad0: f32,
     pub aabb_max: [f32; 3],
+    pub _pad1: f32,
     pub cone_apex: [f32; 3],
+    pub _pad2: f32,
     pub cone_axis: [f32; 3],
     pub cone_cutoff: f32,
-    pub _pad: [f32; 3],
+    pub _pad: [f32; 4],
 }
 
+// Stride del `Meshlet` std430 del shader; si esto falla, el task shader
+// leerá los meshlets corridos.
+const _: () = assert!(std::mem::size_of::<Meshlet>() == 96);
+
 pub struct MeshletBuilder;
 
 impl MeshletBuilder {
+    /// Particiona la geometría en meshlets con remapeo local de vértices.
+    ///
+    /// Cada meshlet referencia hasta `max_vertices` vértices únicos mediante
+    /// `vertex_indices` y sus triángulos con índices locales de 8 bits en
+    /// `triangle_indices`. Se calcula AABB y cono de normales (axis = normal
+    /// promedio, cutoff = cos de la desviación máxima) para que el task
+    /// shader pueda descartar clusters por frustum y backface.
     pub fn build(
         vertices: &[[f32; 3]],
         indices: &[u32],
         max_vertices: u32,
         max_triangles: u32,
-    ) -> Vec<Meshlet> {
+    ) -> MeshletMesh {
+        let mut mesh = MeshletMesh::default();
         let triangle_count = indices.len() / 3;
-        let mut meshlets = Vec::new();
 
-        let triangles_per_meshlet = max_triangles as usize;
-        let mut current_triangle = 0;
+        // Estado del meshlet en construcción.
+        let mut local_map: std::collections::HashMap<u32, u8> = std::collections::HashMap::new();
+        let mut meshlet_start_vertex = 0u32;
+        let mut meshlet_start_index = 0u32;
+        let mut normals: Vec<Vec3> = Vec::new();
 
-        while current_triangle < triangle_count {
-            let end_triangle = (current_triangle + triangles_per_meshlet).min(triangle_count);
-            let index_start = current_triangle * 3;
-            let index_end = end_triangle * 3;
+        let flush = |mesh: &mut MeshletMesh,
+                     local_map: &mut std::collections::HashMap<u32, u8>,
+                     normals: &mut Vec<Vec3>,
+                     start_vertex: &mut u32,
+                     start_index: &mut u32| {
+            if local_map.is_empty() {
+                return;
+            }
+
+            let vertex_count = local_map.len() as u32;
+            let index_count = mesh.triangle_indices.len() as u32 - *start_index;
 
+            // AABB sobre los vértices únicos del meshlet.
             let mut aabb_min = [f32::MAX; 3];
             let mut aabb_max = [f32::MIN; 3];
-
-            for i in (index_start..index_end).step_by(3) {
-                for j in 0..3 {
-                    let idx = indices[i + j] as usize;
-                    if idx < vertices.len() {
-                        let v = vertices[idx];
-                        for k in 0..3 {
-                            aabb_min[k] = aabb_min[k].min(v[k]);
-                            aabb_max[k] = aabb_max[k].max(v[k]);
-                        }
-                    }
+            for &global in mesh.vertex_indices[*start_vertex as usize..].iter() {
+                let v = vertices[global as usize];
+                for k in 0..3 {
+                    aabb_min[k] = aabb_min[k].min(v[k]);
+                    aabb_max[k] = aabb_max[k].max(v[k]);
                 }
             }
 
-            let unique_vertices: std::collections::HashSet<u32> =
-                indices[index_start..index_end].iter().copied().collect();
-
-            if unique_vertices.len() <= max_vertices as usize {
-                meshlets.push(Meshlet {
-                    vertex_offset: 0,
-                    vertex_count: unique_vertices.len() as u32,
-                    index_offset: index_start as u32,
-                    index_count: (index_end - index_start) as u32,
-                    aabb_min,
-                    aabb_max,
-                    cone_apex: [0.0; 3],
-                    cone_axis: [0.0, 0.0, 1.0],
-                    cone_cutoff: 0.0,
-                    _pad: [0.0; 3],
+            // Cono de normales: axis = promedio, cutoff = cos(desviación máxima).
+            let mut axis = Vec3::ZERO;
+            for n in normals.iter() {
+                axis += *n;
+            }
+            let axis = axis.normalize_or_zero();
+            let mut min_dot = 1.0f32;
+            for n in normals.iter() {
+                min_dot = min_dot.min(axis.dot(*n));
+            }
+            // Un cono degenerado (normales opuestas) nunca debe cullear.
+            let cone_cutoff = if axis == Vec3::ZERO || min_dot <= 0.0 {
+                -1.0
+            } else {
+                // cos(θ + 90°) = -sin(θ): el test estándar del cono usa
+                // dot(view, axis) >= cutoff para descartar.
+                -(1.0 - min_dot * min_dot).max(0.0).sqrt()
+            };
+
+            let apex = [
+                (aabb_min[0] + aabb_max[0]) * 0.5,
+                (aabb_min[1] + aabb_max[1]) * 0.5,
+                (aabb_min[2] + aabb_max[2]) * 0.5,
+            ];
+
+            mesh.meshlets.push(Meshlet {
+                vertex_offset: *start_vertex,
+                vertex_count,
+                index_offset: *start_index,
+                index_count,
+                aabb_min,
+                aabb_max,
+                cone_apex: apex,
+                cone_axis: axis.to_array(),
+                cone_cutoff,
+                ..Default::default()
+            });
+
+            local_map.clear();
+            normals.clear();
+            *start_vertex = mesh.vertex_indices.len() as u32;
+            *start_index = mesh.triangle_indices.len() as u32;
+        };
+
+        for tri in 0..triangle_count {
+            let tri_indices = [indices[tri * 3], indices[tri * 3 + 1], indices[tri * 3 + 2]];
+
+            // ¿Entra el triángulo en el meshlet actual?
+            let new_vertices = tri_indices
+                .iter()
+                .filter(|i| !local_map.contains_key(i))
+                .count() as u32;
+            let current_triangles =
+                (mesh.triangle_indices.len() as u32 - meshlet_start_index) / 3;
+            if local_map.len() as u32 + new_vertices > max_vertices
+                || current_triangles + 1 > max_triangles
+            {
+                flush(
+                    &mut mesh,
+                    &mut local_map,
+                    &mut normals,
+                    &mut meshlet_start_vertex,
+                    &mut meshlet_start_index,
+                );
+            }
+
+            for &global in &tri_indices {
+                let next_local = local_map.len() as u8;
+                let local = *local_map.entry(global).or_insert_with(|| {
+                    mesh.vertex_indices.push(global);
+                    next_local
                 });
+                mesh.triangle_indices.push(local);
             }
 
-            current_triangle = end_triangle;
+            let a = Vec3::from(vertices[tri_indices[0] as usize]);
+            let b = Vec3::from(vertices[tri_indices[1] as usize]);
+            let c = Vec3::from(vertices[tri_indices[2] as usize]);
+            normals.push((b - a).cross(c - a).normalize_or_zero());
         }
 
-        meshlets
+        flush(
+            &mut mesh,
+            &mut local_map,
+            &mut normals,
+            &mut meshlet_start_vertex,
+            &mut meshlet_start_index,
+        );
+
+        mesh
+    }
+}
+
+// =============================================================================
+// MeshletMesh — formato cocido
+// =============================================================================
+
+/// Meshlets cocidos de un mesh, listos para subir a storage buffers.
+///
+/// Tres arrays planos: descriptores de meshlet, índices al vertex buffer del
+/// mesh (remapeo global) e índices locales de triángulo (u8). El formato en
+/// disco es binario con header `RMLT`, pensado para empaquetarse en el asset
+/// pack junto al resto del modelo cocido.
+#[derive(Clone, Debug, Default)]
+pub struct MeshletMesh {
+    pub meshlets: Vec<Meshlet>,
+    pub vertex_indices: Vec<u32>,
+    pub triangle_indices: Vec<u8>,
+}
+
+const MESHLET_MAGIC: &[u8; 4] = b"RMLT";
+// v2: stride de Meshlet alineado al layout std430 del shader (96 bytes).
+const MESHLET_VERSION: u32 = 2;
+
+impl MeshletMesh {
+    /// Cocina meshlets desde la salida del `GltfLoader` con los límites
+    /// estándar (64 vértices / 124 triángulos).
+    pub fn from_gltf(mesh: &GltfMeshData) -> Self {
+        let positions: Vec<[f32; 3]> = mesh.vertices.iter().map(|v| v.position).collect();
+        MeshletBuilder::build(
+            &positions,
+            &mesh.indices,
+            MESHLET_MAX_VERTICES,
+            MESHLET_MAX_TRIANGLES,
+        )
+    }
+
+    pub fn meshlet_count(&self) -> u32 {
+        self.meshlets.len() as u32
+    }
+
+    /// Serializa al formato cocido (header + arrays planos, little-endian).
+    pub fn to_bytes(&self) -> Vec<u8> {
+        let mut out = Vec::with_capacity(
+            16 + self.meshlets.len() * std::mem::size_of::<Meshlet>()
+                + self.vertex_indices.len() * 4
+                + self.triangle_indices.len(),
+        );
+        out.extend_from_slice(MESHLET_MAGIC);
+        out.extend_from_slice(&MESHLET_VERSION.to_le_bytes());
+        out.extend_from_slice(&(self.meshlets.len() as u32).to_le_bytes());
+        out.extend_from_slice(&(self.vertex_indices.len() as u32).to_le_bytes());
+        out.extend_from_slice(&(self.triangle_indices.len() as u32).to_le_bytes());
+        out.extend_from_slice(bytemuck::cast_slice(&self.meshlets));
+        out.extend_from_slice(bytemuck::cast_slice(&self.vertex_indices));
+        out.extend_from_slice(&self.triangle_indices);
+        out
+    }
+
+    /// Deserializa el formato cocido; valida magic, versión y tamaños.
+    pub fn from_bytes(bytes: &[u8]) -> ReactorResult<Self> {
+        if bytes.len() < 20 || &bytes[0..4] != MESHLET_MAGIC {
+            return Err(ReactorError::asset_load("Invalid meshlet data: bad magic"));
+        }
+        let read_u32 = |offset: usize| {
+            u32::from_le_bytes(bytes[offset..offset + 4].try_into().unwrap())
+        };
+        let version = read_u32(4);
+        if version != MESHLET_VERSION {
+            return Err(ReactorError::asset_load(format!(
+                "Unsupported meshlet version: {version}"
+            )));
+        }
+        let meshlet_count = read_u32(8) as usize;
+        let vertex_count = read_u32(12) as usize;
+        let triangle_count = read_u32(16) as usize;
+
+        let meshlets_size = meshlet_count * std::mem::size_of::<Meshlet>();
+        let expected = 20 + meshlets_size + vertex_count * 4 + triangle_count;
+        if bytes.len() < expected {
+            return Err(ReactorError::asset_load("Truncated meshlet data"));
+        }
+
+        let mut cursor = 20;
+        let meshlets =
+            bytemuck::cast_slice::<u8, Meshlet>(&bytes[cursor..cursor + meshlets_size]).to_vec();
+        cursor += meshlets_size;
+        let vertex_indices =
+            bytemuck::cast_slice::<u8, u32>(&bytes[cursor..cursor + vertex_count * 4]).to_vec();
+        cursor += vertex_count * 4;
+        let triangle_indices = bytes[cursor..cursor + triangle_count].to_vec();
+
+        Ok(Self {
+            meshlets,
+            vertex_indices,
+            triangle_indices,
+        })
     }
 }
 
@@ -88,9 +287,73 @@ mod tests {
         ];
         let indices: Vec<u32> = vec![0, 1, 2, 1, 3, 2];
 
-        let meshlets = MeshletBuilder::build(&vertices, &indices, 64, 124);
-        assert_eq!(meshlets.len(), 1);
-        assert_eq!(meshlets[0].index_count, 6);
-        assert_eq!(meshlets[0].vertex_count, 4);
+        let mesh = MeshletBuilder::build(&vertices, &indices, 64, 124);
+        assert_eq!(mesh.meshlets.len(), 1);
+        assert_eq!(mesh.meshlets[0].index_count, 6);
+        assert_eq!(mesh.meshlets[0].vertex_count, 4);
+        // Índices locales válidos dentro del meshlet.
+        assert!(mesh.triangle_indices.iter().all(|&i| (i as u32) < 4));
+    }
+
+    #[test]
+    fn respects_vertex_and_triangle_limits() {
+        // Malla de tiras: 200 triángulos sobre 202 vértices.
+        let mut vertices = Vec::new();
+        let mut indices = Vec::new();
+        for i in 0..101u32 {
+            vertices.push([i as f32, 0.0, 0.0]);
+            vertices.push([i as f32, 1.0, 0.0]);
+        }
+        for i in 0..100u32 {
+            let base = i * 2;
+            indices.extend_from_slice(&[base, base + 1, base + 2]);
+            indices.extend_from_slice(&[base + 1, base + 3, base + 2]);
+        }
+
+        let mesh = MeshletBuilder::build(&vertices, &indices, 16, 32);
+        assert!(mesh.meshlets.len() > 1);
+        let mut total_triangles = 0;
+        for m in &mesh.meshlets {
+            assert!(m.vertex_count <= 16);
+            assert!(m.index_count / 3 <= 32);
+            total_triangles += m.index_count / 3;
+        }
+        assert_eq!(total_triangles, 200);
+    }
+
+    #[test]
+    fn planar_patch_gets_tight_cone() {
+        // Todos los triángulos miran a +Z → el cono debe permitir backface cull.
+        let vertices: Vec<[f32; 3]> = vec![
+            [0.0, 0.0, 0.0],
+            [1.0, 0.0, 0.0],
+            [0.0, 1.0, 0.0],
+            [1.0, 1.0, 0.0],
+        ];
+        let indices: Vec<u32> = vec![0, 1, 3, 0, 3, 2];
+
+        let mesh = MeshletBuilder::build(&vertices, &indices, 64, 124);
+        let m = &mesh.meshlets[0];
+        assert!((Vec3::from(m.cone_axis) - Vec3::Z).length() < 1e-5);
+        assert!((m.cone_cutoff - 0.0).abs() < 1e-5);
+    }
+
+    #[test]
+    fn cooked_format_roundtrips() {
+        let vertices: Vec<[f32; 3]> = vec![
+            [0.0, 0.0, 0.0],
+            [1.0, 0.0, 0.0],
+            [0.0, 1.0, 0.0],
+        ];
+        let indices: Vec<u32> = vec![0, 1, 2];
+        let mesh = MeshletBuilder::build(&vertices, &indices, 64, 124);
+
+        let bytes = mesh.to_bytes();
+        let restored = MeshletMesh::from_bytes(&bytes).unwrap();
+        assert_eq!(restored.meshlets.len(), mesh.meshlets.len());
+        assert_eq!(restored.vertex_indices, mesh.vertex_indices);
+        assert_eq!(restored.triangle_indices, mesh.triangle_indices);
+
+        assert!(MeshletMesh::from_bytes(b"garbage").is_err());
     }
 }
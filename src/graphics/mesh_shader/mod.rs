@@ -6,5 +6,5 @@ pub use features::{
     check_mesh_shader_support, mesh_shader_feature_chain, query_mesh_shader_properties,
     MeshShaderProperties,
 };
-pub use meshlet::{Meshlet, MeshletBuilder};
+pub use meshlet::{Meshlet, MeshletBuilder, MeshletMesh, MESHLET_MAX_TRIANGLES, MESHLET_MAX_VERTICES};
 pub use pipeline::MeshShaderPipeline;
@@ -20,9 +20,13 @@ pub mod shadows;
 pub mod swapchain;
 pub mod temporal;
 pub mod uniform_buffer;
+pub mod upload;
 
 pub use buffer::Buffer;
-pub use debug_renderer::{DebugLine, DebugRenderer};
+pub use debug_renderer::{
+    unit_cube_edges, unit_sphere_edges, DebugGpuBuffers, DebugLine, DebugRenderer,
+    DebugShapeInstance, DebugVertex,
+};
 pub use depth::DepthBuffer;
 pub use descriptors::{
     DescriptorBinding, DescriptorPool, DescriptorSet, DescriptorSetLayout, PoolSize,
@@ -42,12 +46,14 @@ pub use sampler::{FilterMode, Sampler, SamplerConfig, WrapMode};
 pub use shadows::{ShadowCascade, ShadowConfig, ShadowMap, ShadowUniformData};
 pub use swapchain::Swapchain;
 pub use temporal::TemporalHistory;
+pub use upload::{UploadEngine, UploadTicket};
 pub use uniform_buffer::{
     GlobalUniformData, LightData, LightUniformData, MaterialUniformData, UniformBuffer,
 };
 
 // ═══ FASE 2 — Pipeline gráfico moderno ═══
 pub mod bindless;
+pub mod gpu_culling;
 pub mod indirect;
 pub mod mesh_shader;
 pub mod pso_cache;
@@ -59,15 +65,19 @@ pub use bindless::{
     BindlessConfig, BindlessRegistry, BindlessStats, BufferHandle, GpuMaterialData, GpuMeshData,
     MaterialHandle, MeshHandle, SamplerHandle, TextureHandle,
 };
+pub use gpu_culling::{GpuCullingPass, GpuObjectAabb};
 pub use indirect::{DrawIndexedIndirectCommand, IndirectCommandWithMaterial, IndirectDrawBuffer};
 pub use mesh_shader::{
     check_mesh_shader_support, mesh_shader_feature_chain, query_mesh_shader_properties,
-    MeshShaderPipeline, MeshShaderProperties, Meshlet, MeshletBuilder,
+    MeshShaderPipeline, MeshShaderProperties, Meshlet, MeshletBuilder, MeshletMesh,
+};
+pub use pso_cache::{
+    CachedPipeline, PsoCache, PsoCacheManager, SerializablePsoEntry, WarmupProgress, WarmupStats,
 };
-pub use pso_cache::{CachedPipeline, PsoCache, PsoCacheManager, SerializablePsoEntry};
 pub use pso_hash::{PsoHash, PsoHashBuilder};
 pub use shader_compiler::{
-    BindingType, CompiledShader, ReflectedBinding, ReflectedEntryPoint, ReflectedPushConstant,
-    ShaderCompiler, ShaderLanguage, ShaderReflection, ShaderStage,
+    BindingType, CachedShaderCompiler, CompiledShader, ReflectedBinding, ReflectedEntryPoint,
+    ReflectedPushConstant, ShaderCacheStats, ShaderCompiler, ShaderDiskCache, ShaderLanguage,
+    ShaderReflection, ShaderStage,
 };
 pub use shader_hot_reload::{ShaderHotReloader, ShaderReloadEvent};
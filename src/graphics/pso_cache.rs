@@ -18,6 +18,7 @@ use std::collections::HashMap;
 use std::fs;
 use std::io::{self, BufReader, BufWriter, Write};
 use std::path::{Path, PathBuf};
+use std::sync::atomic::{AtomicUsize, Ordering as AtomicOrdering};
 use std::sync::{Arc, Mutex};
 
 use crate::core::arc_handle::ArcDevice;
@@ -317,6 +318,115 @@ impl PsoCache {
             .load()
             .map_err(|e| ReactorError::with_source(ErrorCode::IoError, "PSO cache load failed", e))
     }
+
+    /// Precompila en background todos los PSOs registrados en el cache de
+    /// disco, antes del primer frame.
+    ///
+    /// `compile` reconstruye un pipeline desde su entrada serializada (el
+    /// renderer sabe cómo; debe usar `vk_pipeline_cache()` para que el driver
+    /// aproveche su blob). Las compilaciones se reparten entre `threads`
+    /// workers — `vkCreateGraphicsPipelines` contra un mismo PipelineCache es
+    /// thread-safe — y `progress(done, total)` se invoca tras cada pipeline
+    /// para alimentar una pantalla de "compilando shaders".
+    ///
+    /// Entradas que fallan (shader renombrado, formato viejo) se saltan y se
+    /// recompilarán lazy por `get_or_create` como antes.
+    pub fn warmup<F>(
+        &self,
+        compile: F,
+        threads: usize,
+        progress: Option<WarmupProgress>,
+    ) -> ReactorResult<WarmupStats>
+    where
+        F: Fn(&SerializablePsoEntry) -> ReactorResult<CachedPipeline> + Send + Sync,
+    {
+        let entries = self.load_entries()?;
+        let mut stats = WarmupStats::default();
+
+        // Saltar lo que ya está en memoria (p.ej. warmup repetido).
+        let pending: Vec<&SerializablePsoEntry> = {
+            let cached = self.pipelines.lock().unwrap();
+            entries
+                .iter()
+                .filter(|e| {
+                    let hit = cached.contains_key(&PsoHash(e.hash));
+                    if hit {
+                        stats.skipped += 1;
+                    }
+                    !hit
+                })
+                .collect()
+        };
+
+        let total = pending.len();
+        if total == 0 {
+            return Ok(stats);
+        }
+
+        let threads = threads.max(1);
+        let next = AtomicUsize::new(0);
+        let done = AtomicUsize::new(0);
+        let compiled = AtomicUsize::new(0);
+        let failed = AtomicUsize::new(0);
+        let next = &next;
+        let done = &done;
+        let compiled = &compiled;
+        let failed = &failed;
+        let compile = &compile;
+        let progress = progress.as_ref();
+        let pending = &pending;
+        let pipelines = &self.pipelines;
+
+        crate::core::jobs::scope(|s| {
+            for _ in 0..threads.min(total) {
+                s.spawn(move |_| loop {
+                    let i = next.fetch_add(1, AtomicOrdering::Relaxed);
+                    if i >= total {
+                        break;
+                    }
+                    let entry = pending[i];
+                    match compile(entry) {
+                        Ok(pipeline) => {
+                            pipelines
+                                .lock()
+                                .unwrap()
+                                .insert(PsoHash(entry.hash), pipeline);
+                            compiled.fetch_add(1, AtomicOrdering::Relaxed);
+                        }
+                        Err(e) => {
+                            log::warn!("⚠ PSO warmup: entry {:016x} failed: {}", entry.hash, e);
+                            failed.fetch_add(1, AtomicOrdering::Relaxed);
+                        }
+                    }
+                    let finished = done.fetch_add(1, AtomicOrdering::Relaxed) + 1;
+                    if let Some(cb) = progress {
+                        cb(finished, total);
+                    }
+                });
+            }
+        });
+
+        stats.compiled = compiled.load(AtomicOrdering::Relaxed);
+        stats.failed = failed.load(AtomicOrdering::Relaxed);
+        log::info!(
+            "⚡ PSO warmup: {} compiled, {} skipped, {} failed",
+            stats.compiled,
+            stats.skipped,
+            stats.failed
+        );
+        Ok(stats)
+    }
+}
+
+/// Callback de progreso del warmup: `(pipelines listos, total)`.
+pub type WarmupProgress = Box<dyn Fn(usize, usize) + Send + Sync>;
+
+/// Resultado del warmup de PSOs.
+#[derive(Clone, Copy, Debug, Default)]
+pub struct WarmupStats {
+    pub compiled: usize,
+    pub skipped: usize,
+    pub failed: usize,
 }
 
 impl Drop for PsoCache {
@@ -0,0 +1,437 @@
+//! # Shader Disk Cache — SPIR-V persistido keyed por hash de contenido
+//!
+//! La traducción naga (WGSL/GLSL → SPIR-V) se paga una sola vez: cada shader
+//! compilado se guarda en disco bajo una key xxh3 de `source + defines +
+//! stage + entry point`, junto con su reflexión ya extraída. En arranques
+//! calientes el cache devuelve el `CompiledShader` completo sin tocar naga.
+//! Los misses de un batch se compilan en paralelo en el job system.
+//!
+//! ## Capas (mismo esquema que `PsoCache`)
+//!
+//! 1. **Disco** (`.reactor/shaders/{key}.rshc`) — un archivo bincode por
+//!    shader, validado por magic + versión + key.
+//! 2. **Compilación** — solo para misses; `compile_batch` los reparte entre
+//!    workers (cada worker usa su propio `Validator`, que no es `Sync`).
+
+use std::fs;
+use std::path::{Path, PathBuf};
+use std::sync::Mutex;
+
+use serde::{Deserialize, Serialize};
+use xxhash_rust::xxh3::Xxh3;
+
+use crate::core::error::{ErrorCode, ReactorError, ReactorResult};
+use crate::core::jobs;
+
+use super::compiler::ShaderCompiler;
+use super::types::{CompiledShader, ShaderLanguage, ShaderStage};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Constantes del formato de archivo
+// ═══════════════════════════════════════════════════════════════════════════
+
+/// Magic bytes: "RSHC" (Reactor SHader Cache).
+const SHADER_CACHE_MAGIC: u32 = 0x52534843;
+/// Versión del formato. Bump cuando cambie `CompiledShader` o la reflexión.
+const SHADER_CACHE_VERSION: u32 = 1;
+
+#[derive(Serialize, Deserialize)]
+struct CachedShaderFile {
+    magic: u32,
+    version: u32,
+    /// Key con la que se guardó — detecta colisiones de nombre de archivo.
+    key: u64,
+    shader: CompiledShader,
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ShaderDiskCache
+// ═══════════════════════════════════════════════════════════════════════════
+
+pub struct ShaderDiskCache {
+    cache_dir: PathBuf,
+}
+
+impl ShaderDiskCache {
+    pub fn new(cache_dir: &Path) -> ReactorResult<Self> {
+        fs::create_dir_all(cache_dir).map_err(|e| {
+            ReactorError::with_source(
+                ErrorCode::IoError,
+                format!("Failed to create shader cache dir: {}", cache_dir.display()),
+                e,
+            )
+        })?;
+        Ok(Self {
+            cache_dir: cache_dir.to_path_buf(),
+        })
+    }
+
+    /// Key de cache: xxh3 del source + defines + lenguaje + stage + entry point.
+    ///
+    /// Mismo hasher que el asset pipeline (`AssetDatabase::compute_content_hash`);
+    /// el FNV de `utils::hash` se reserva para IDs cortos.
+    pub fn shader_key(
+        source: &str,
+        lang: ShaderLanguage,
+        stage: ShaderStage,
+        entry_point: &str,
+        defines: &[(String, String)],
+    ) -> u64 {
+        let mut hasher = Xxh3::new();
+        hasher.update(source.as_bytes());
+        hasher.update(&[lang as u8, stage as u8]);
+        hasher.update(entry_point.as_bytes());
+        for (name, value) in defines {
+            hasher.update(name.as_bytes());
+            hasher.update(b"=");
+            hasher.update(value.as_bytes());
+            hasher.update(b";");
+        }
+        hasher.digest()
+    }
+
+    fn entry_path(&self, key: u64) -> PathBuf {
+        self.cache_dir.join(format!("{:016x}.rshc", key))
+    }
+
+    /// Busca un shader compilado en disco. Entradas corruptas, de versión
+    /// vieja o con key distinta se descartan (y se borran) silenciosamente.
+    pub fn load(&self, key: u64) -> Option<CompiledShader> {
+        let path = self.entry_path(key);
+        let bytes = fs::read(&path).ok()?;
+        match bincode::deserialize::<CachedShaderFile>(&bytes) {
+            Ok(file)
+                if file.magic == SHADER_CACHE_MAGIC
+                    && file.version == SHADER_CACHE_VERSION
+                    && file.key == key =>
+            {
+                Some(file.shader)
+            }
+            _ => {
+                let _ = fs::remove_file(&path);
+                None
+            }
+        }
+    }
+
+    /// Persiste un shader compilado. Escribe a un temporal y renombra para
+    /// que un crash a mitad de escritura no deje una entrada corrupta.
+    pub fn store(&self, key: u64, shader: &CompiledShader) -> ReactorResult<()> {
+        let file = CachedShaderFile {
+            magic: SHADER_CACHE_MAGIC,
+            version: SHADER_CACHE_VERSION,
+            key,
+            shader: shader.clone(),
+        };
+        let bytes = bincode::serialize(&file).map_err(|e| {
+            ReactorError::new(
+                ErrorCode::InvalidFormat,
+                format!("Failed to serialize shader cache entry: {}", e),
+            )
+        })?;
+
+        let path = self.entry_path(key);
+        let tmp = path.with_extension("rshc.tmp");
+        fs::write(&tmp, &bytes)
+            .and_then(|_| fs::rename(&tmp, &path))
+            .map_err(|e| {
+                ReactorError::with_source(
+                    ErrorCode::IoError,
+                    format!("Failed to write shader cache entry: {}", path.display()),
+                    e,
+                )
+            })
+    }
+
+    /// Borra todas las entradas del cache.
+    pub fn clear(&self) -> ReactorResult<()> {
+        if self.cache_dir.exists() {
+            for entry in fs::read_dir(&self.cache_dir)
+                .map_err(|e| ReactorError::with_source(ErrorCode::IoError, "read_dir failed", e))?
+            {
+                let Ok(entry) = entry else { continue };
+                if entry.path().extension().and_then(|e| e.to_str()) == Some("rshc") {
+                    let _ = fs::remove_file(entry.path());
+                }
+            }
+        }
+        Ok(())
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// CachedShaderCompiler
+// ═══════════════════════════════════════════════════════════════════════════
+
+/// `ShaderCompiler` con cache de disco delante: hits devuelven el SPIR-V y la
+/// reflexión persistidos sin ejecutar naga; misses compilan y persisten.
+pub struct CachedShaderCompiler {
+    compiler: ShaderCompiler,
+    cache: ShaderDiskCache,
+    hits: usize,
+    misses: usize,
+}
+
+/// Estadísticas de una pasada de compilación con cache.
+#[derive(Clone, Copy, Debug, Default)]
+pub struct ShaderCacheStats {
+    pub hits: usize,
+    pub misses: usize,
+}
+
+impl CachedShaderCompiler {
+    pub fn new(cache_dir: &Path) -> ReactorResult<Self> {
+        Ok(Self {
+            compiler: ShaderCompiler::new(),
+            cache: ShaderDiskCache::new(cache_dir)?,
+            hits: 0,
+            misses: 0,
+        })
+    }
+
+    /// Compila source con cache. En hit no se toca naga.
+    pub fn compile_source(
+        &mut self,
+        source: &str,
+        lang: ShaderLanguage,
+        stage: ShaderStage,
+        entry_point: &str,
+    ) -> ReactorResult<CompiledShader> {
+        let key = ShaderDiskCache::shader_key(source, lang, stage, entry_point, &[]);
+        if let Some(cached) = self.cache.load(key) {
+            self.hits += 1;
+            return Ok(cached);
+        }
+
+        let compiled = self.compiler.compile_source(source, lang, stage, entry_point)?;
+        if let Err(e) = self.cache.store(key, &compiled) {
+            log::warn!("⚠ Shader cache store failed ({:016x}): {}", key, e);
+        }
+        self.misses += 1;
+        Ok(compiled)
+    }
+
+    /// Compila un archivo con cache (mismo contrato que
+    /// `ShaderCompiler::compile_file`).
+    pub fn compile_file(
+        &mut self,
+        path: &Path,
+        stage: ShaderStage,
+        entry_point: &str,
+    ) -> ReactorResult<CompiledShader> {
+        let source = fs::read_to_string(path).map_err(|e| {
+            ReactorError::with_source(
+                ErrorCode::IoError,
+                format!("Failed to read shader file: {}", path.display()),
+                e,
+            )
+        })?;
+
+        let ext = path.extension().and_then(|e| e.to_str()).unwrap_or("");
+        let lang = ShaderLanguage::from_extension(ext).ok_or_else(|| {
+            ReactorError::new(
+                ErrorCode::InvalidArgument,
+                format!("Unsupported shader extension: {}", ext),
+            )
+        })?;
+
+        self.compile_source(&source, lang, stage, entry_point)
+    }
+
+    /// Compila un batch de archivos: hits se sirven de disco, misses se
+    /// reparten entre workers del job system (cada worker con su propio
+    /// `Validator`). Retorna los shaders en el mismo orden que `paths`.
+    ///
+    /// Pensado para el startup: con cache caliente no se ejecuta naga ni una
+    /// sola vez.
+    pub fn compile_batch(
+        &mut self,
+        paths: &[(PathBuf, ShaderStage)],
+        entry_point: &str,
+    ) -> ReactorResult<Vec<CompiledShader>> {
+        struct PendingMiss {
+            index: usize,
+            source: String,
+            lang: ShaderLanguage,
+            stage: ShaderStage,
+            key: u64,
+        }
+
+        let mut results: Vec<Option<CompiledShader>> = (0..paths.len()).map(|_| None).collect();
+        let mut misses: Vec<PendingMiss> = Vec::new();
+
+        // Fase 1 (serial, solo I/O): leer sources y resolver hits de disco.
+        for (index, (path, stage)) in paths.iter().enumerate() {
+            let source = fs::read_to_string(path).map_err(|e| {
+                ReactorError::with_source(
+                    ErrorCode::IoError,
+                    format!("Failed to read shader file: {}", path.display()),
+                    e,
+                )
+            })?;
+            let ext = path.extension().and_then(|e| e.to_str()).unwrap_or("");
+            let lang = ShaderLanguage::from_extension(ext).ok_or_else(|| {
+                ReactorError::new(
+                    ErrorCode::InvalidArgument,
+                    format!("Unsupported shader extension: {}", ext),
+                )
+            })?;
+
+            let key = ShaderDiskCache::shader_key(&source, lang, *stage, entry_point, &[]);
+            if let Some(cached) = self.cache.load(key) {
+                self.hits += 1;
+                results[index] = Some(cached);
+            } else {
+                misses.push(PendingMiss {
+                    index,
+                    source,
+                    lang,
+                    stage: *stage,
+                    key,
+                });
+            }
+        }
+
+        // Fase 2 (paralela): compilar los misses. `Validator` no es `Sync`,
+        // así que cada iteración usa un compilador propio (crearlo es barato
+        // comparado con la traducción).
+        let outcomes: Mutex<Vec<(usize, u64, ReactorResult<CompiledShader>)>> =
+            Mutex::new(Vec::with_capacity(misses.len()));
+        jobs::parallel_for(0..misses.len(), |i| {
+            let miss = &misses[i];
+            let result = ShaderCompiler::new().compile_source(
+                &miss.source,
+                miss.lang,
+                miss.stage,
+                entry_point,
+            );
+            outcomes.lock().unwrap().push((miss.index, miss.key, result));
+        });
+
+        // Fase 3 (serial, solo I/O): persistir y colocar en orden.
+        for (index, key, result) in outcomes.into_inner().unwrap() {
+            let compiled = result?;
+            if let Err(e) = self.cache.store(key, &compiled) {
+                log::warn!("⚠ Shader cache store failed ({:016x}): {}", key, e);
+            }
+            self.misses += 1;
+            results[index] = Some(compiled);
+        }
+
+        Ok(results.into_iter().map(|r| r.unwrap()).collect())
+    }
+
+    /// Hits/misses acumulados desde la creación.
+    pub fn stats(&self) -> ShaderCacheStats {
+        ShaderCacheStats {
+            hits: self.hits,
+            misses: self.misses,
+        }
+    }
+
+    /// Acceso al cache de disco (para `ShaderHotReloader::set_disk_cache`).
+    pub fn cache(&self) -> &ShaderDiskCache {
+        &self.cache
+    }
+
+    /// Acceso al compilador interno (para SPIR-V precompilado, que no pasa
+    /// por el cache).
+    pub fn compiler(&mut self) -> &mut ShaderCompiler {
+        &mut self.compiler
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// Tests
+// ═══════════════════════════════════════════════════════════════════════════
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    const TRIVIAL_WGSL: &str = r#"
+@fragment
+fn main() -> @location(0) vec4<f32> {
+    return vec4<f32>(1.0, 0.0, 1.0, 1.0);
+}
+"#;
+
+    fn temp_cache_dir(tag: &str) -> PathBuf {
+        std::env::temp_dir().join(format!("reactor_shader_cache_{}_{}", tag, std::process::id()))
+    }
+
+    #[test]
+    fn test_shader_key_sensitive_to_defines_and_stage() {
+        let base = ShaderDiskCache::shader_key(
+            "void main() {}",
+            ShaderLanguage::Glsl,
+            ShaderStage::Fragment,
+            "main",
+            &[],
+        );
+        let with_define = ShaderDiskCache::shader_key(
+            "void main() {}",
+            ShaderLanguage::Glsl,
+            ShaderStage::Fragment,
+            "main",
+            &[("MSAA".into(), "4".into())],
+        );
+        let other_stage = ShaderDiskCache::shader_key(
+            "void main() {}",
+            ShaderLanguage::Glsl,
+            ShaderStage::Vertex,
+            "main",
+            &[],
+        );
+        assert_ne!(base, with_define);
+        assert_ne!(base, other_stage);
+    }
+
+    #[test]
+    fn test_warm_compile_skips_naga() -> ReactorResult<()> {
+        let dir = temp_cache_dir("warm");
+        let _ = fs::remove_dir_all(&dir);
+
+        let mut compiler = CachedShaderCompiler::new(&dir)?;
+        let cold = compiler.compile_source(
+            TRIVIAL_WGSL,
+            ShaderLanguage::Wgsl,
+            ShaderStage::Fragment,
+            "main",
+        )?;
+        assert_eq!(compiler.stats().misses, 1);
+
+        // Segunda pasada con un compilador nuevo: hit de disco, mismo SPIR-V
+        // y misma reflexión sin re-traducir.
+        let mut warm_compiler = CachedShaderCompiler::new(&dir)?;
+        let warm = warm_compiler.compile_source(
+            TRIVIAL_WGSL,
+            ShaderLanguage::Wgsl,
+            ShaderStage::Fragment,
+            "main",
+        )?;
+        assert_eq!(warm_compiler.stats().hits, 1);
+        assert_eq!(warm.spirv, cold.spirv);
+        assert_eq!(warm.spirv_hash, cold.spirv_hash);
+        assert_eq!(warm.reflection.entry_points.len(), cold.reflection.entry_points.len());
+
+        let _ = fs::remove_dir_all(&dir);
+        Ok(())
+    }
+
+    #[test]
+    fn test_corrupt_entry_is_discarded() -> ReactorResult<()> {
+        let dir = temp_cache_dir("corrupt");
+        let _ = fs::remove_dir_all(&dir);
+
+        let cache = ShaderDiskCache::new(&dir)?;
+        let key = 0xdeadbeefu64;
+        fs::write(cache.entry_path(key), b"not a shader").unwrap();
+        assert!(cache.load(key).is_none());
+        // La entrada corrupta se borró para no reintentar en cada arranque
+        assert!(!cache.entry_path(key).exists());
+
+        let _ = fs::remove_dir_all(&dir);
+        Ok(())
+    }
+}
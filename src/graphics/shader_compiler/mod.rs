@@ -1,8 +1,10 @@
+pub mod cache;
 pub mod compiled;
 pub mod compiler;
 pub mod reflection;
 pub mod types;
 
+pub use cache::{CachedShaderCompiler, ShaderCacheStats, ShaderDiskCache};
 pub use compiler::ShaderCompiler;
 pub use types::{
     BindingType, CompiledShader, ReflectedBinding, ReflectedEntryPoint, ReflectedPushConstant,
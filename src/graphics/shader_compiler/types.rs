@@ -1,6 +1,27 @@
 use ash::vk;
+use serde::{Deserialize, Serialize};
 use std::ffi::CStr;
 
+/// `vk::ShaderStageFlags` no implementa serde; viaja como su u32 crudo
+/// (necesario para persistir la reflexión en el shader cache de disco).
+mod stage_flags_serde {
+    use ash::vk;
+    use serde::{Deserialize, Deserializer, Serialize, Serializer};
+
+    pub fn serialize<S: Serializer>(
+        flags: &vk::ShaderStageFlags,
+        serializer: S,
+    ) -> Result<S::Ok, S::Error> {
+        flags.as_raw().serialize(serializer)
+    }
+
+    pub fn deserialize<'de, D: Deserializer<'de>>(
+        deserializer: D,
+    ) -> Result<vk::ShaderStageFlags, D::Error> {
+        u32::deserialize(deserializer).map(vk::ShaderStageFlags::from_raw)
+    }
+}
+
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
 pub enum ShaderLanguage {
     Wgsl,
@@ -19,7 +40,7 @@ impl ShaderLanguage {
     }
 }
 
-#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, Serialize, Deserialize)]
 pub enum ShaderStage {
     Vertex,
     Fragment,
@@ -43,7 +64,7 @@ impl ShaderStage {
     }
 }
 
-#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, Serialize, Deserialize)]
 pub enum BindingType {
     UniformBuffer,
     StorageBuffer { read_only: bool },
@@ -70,39 +91,41 @@ impl BindingType {
     }
 }
 
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct ReflectedBinding {
     pub name: String,
     pub group: u32,
     pub binding: u32,
     pub ty: BindingType,
+    #[serde(with = "stage_flags_serde")]
     pub stages: vk::ShaderStageFlags,
     pub size: u32,
     pub count: u32,
 }
 
-#[derive(Debug, Clone, PartialEq, Eq)]
+#[derive(Debug, Clone, PartialEq, Eq, Serialize, Deserialize)]
 pub struct ReflectedPushConstant {
     pub name: String,
+    #[serde(with = "stage_flags_serde")]
     pub stages: vk::ShaderStageFlags,
     pub size: u32,
 }
 
-#[derive(Debug, Clone)]
+#[derive(Debug, Clone, Serialize, Deserialize)]
 pub struct ReflectedEntryPoint {
     pub name: String,
     pub stage: ShaderStage,
     pub workgroup_size: Option<[u32; 3]>,
 }
 
-#[derive(Debug, Clone, Default)]
+#[derive(Debug, Clone, Default, Serialize, Deserialize)]
 pub struct ShaderReflection {
     pub entry_points: Vec<ReflectedEntryPoint>,
     pub bindings: Vec<ReflectedBinding>,
     pub push_constants: Vec<ReflectedPushConstant>,
 }
 
-#[derive(Debug, Clone)]
+#[derive(Debug, Clone, Serialize, Deserialize)]
 pub struct CompiledShader {
     pub spirv: Vec<u32>,
     pub stage: ShaderStage,
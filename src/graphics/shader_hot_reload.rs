@@ -45,7 +45,9 @@ use std::time::{Duration, Instant};
 use notify::{Event, EventKind, RecursiveMode, Watcher};
 
 use crate::core::error::{ErrorCode, ReactorError, ReactorResult};
-use crate::graphics::shader_compiler::{CompiledShader, ShaderCompiler, ShaderStage};
+use crate::graphics::shader_compiler::{
+    CompiledShader, ShaderCompiler, ShaderDiskCache, ShaderLanguage, ShaderStage,
+};
 
 // ═══════════════════════════════════════════════════════════════════════════
 // Tipos
@@ -88,6 +90,9 @@ pub struct ShaderHotReloader {
     /// cuando el editor guarda varias veces en rápida sucesión.
     last_recompile: HashMap<PathBuf, Instant>,
     debounce_ms: u64,
+    /// Cache de disco opcional: cada recompilación exitosa se persiste para
+    /// que el próximo arranque la sirva sin naga.
+    disk_cache: Option<ShaderDiskCache>,
 }
 
 impl ShaderHotReloader {
@@ -151,6 +156,7 @@ impl ShaderHotReloader {
             rx,
             last_recompile: HashMap::new(),
             debounce_ms: 100,
+            disk_cache: None,
         })
     }
 
@@ -172,9 +178,28 @@ impl ShaderHotReloader {
             rx,
             last_recompile: HashMap::new(),
             debounce_ms: 100,
+            disk_cache: None,
         })
     }
 
+    /// Conecta un cache de disco: las recompilaciones del watcher se
+    /// persisten y `watch_shader()` sirve la compilación inicial desde disco.
+    pub fn set_disk_cache(&mut self, cache: ShaderDiskCache) {
+        self.disk_cache = Some(cache);
+    }
+
+    /// Persiste un shader recompilado en el cache de disco (si hay uno).
+    fn store_in_cache(&self, path: &Path, stage: ShaderStage, entry: &str, c: &CompiledShader) {
+        let Some(cache) = &self.disk_cache else { return };
+        let Ok(source) = fs::read_to_string(path) else { return };
+        let ext = path.extension().and_then(|e| e.to_str()).unwrap_or("");
+        let Some(lang) = ShaderLanguage::from_extension(ext) else { return };
+        let key = ShaderDiskCache::shader_key(&source, lang, stage, entry, &[]);
+        if let Err(e) = cache.store(key, c) {
+            log::warn!("⚠ Shader cache store failed for {}: {}", path.display(), e);
+        }
+    }
+
     /// Añade un shader al sistema de watch.
     pub fn watch_shader(
         &mut self,
@@ -193,8 +218,24 @@ impl ShaderHotReloader {
                 )
             })?;
 
+        // Hit de cache → SPIR-V sin naga; miss → compilar y persistir.
         let compiled = if path.exists() {
-            self.compiler.compile_file(path, stage, entry_point).ok()
+            let cached = self.disk_cache.as_ref().and_then(|cache| {
+                let source = fs::read_to_string(path).ok()?;
+                let ext = path.extension().and_then(|e| e.to_str()).unwrap_or("");
+                let lang = ShaderLanguage::from_extension(ext)?;
+                cache.load(ShaderDiskCache::shader_key(&source, lang, stage, entry_point, &[]))
+            });
+            match cached {
+                Some(c) => Some(c),
+                None => {
+                    let compiled = self.compiler.compile_file(path, stage, entry_point).ok();
+                    if let Some(c) = &compiled {
+                        self.store_in_cache(path, stage, entry_point, c);
+                    }
+                    compiled
+                }
+            }
         } else {
             None
         };
@@ -293,6 +334,13 @@ impl ShaderHotReloader {
                             compiled.spirv_hash,
                         );
 
+                        self.store_in_cache(
+                            &self.watched[idx].path,
+                            stage,
+                            &entry_point,
+                            &compiled,
+                        );
+
                         events.push(ShaderReloadEvent {
                             path: self.watched[idx].path.clone(),
                             stage,
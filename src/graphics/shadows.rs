@@ -292,6 +292,142 @@ impl ShadowUniformData {
     }
 }
 
+// =============================================================================
+// Cascade caching — per-cascade update scheduling
+// =============================================================================
+// Re-rendering every cascade each frame is mostly redundant in outdoor
+// scenes: distant cascades barely change from one frame to the next. The
+// cache tracks what each cascade was last rendered with (light direction,
+// snapped ortho matrix, a signature of the shadow casters) and lets the
+// shadow pass keep cached texels when nothing relevant moved, refreshing
+// distant cascades at a reduced cadence.
+//
+// When a cascade is reused, its cached view-projection is written back into
+// the `ShadowMap` so sampling stays consistent with the texels actually in
+// the map.
+// =============================================================================
+
+/// What the shadow pass should do with one cascade this frame.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum CascadeUpdate {
+    /// Clear and re-render the cascade layer.
+    Render,
+    /// Keep last frame's texels; the cached view-projection has been
+    /// restored into the cascade.
+    Reuse,
+}
+
+#[derive(Clone, Debug, Default)]
+struct CascadeCacheEntry {
+    view_proj: Mat4,
+    split_depth: f32,
+    valid: bool,
+    frames_since_render: u32,
+}
+
+/// Per-cascade update scheduler for cached shadow maps.
+#[derive(Clone, Debug, Default)]
+pub struct CascadeCache {
+    entries: Vec<CascadeCacheEntry>,
+    light_direction: Vec3,
+    caster_signature: u64,
+    plan: Vec<CascadeUpdate>,
+}
+
+/// Cosine threshold below which a light rotation invalidates every cascade.
+const LIGHT_DIR_EPSILON: f32 = 0.9999;
+
+impl CascadeCache {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Base refresh interval for a cascade: the near cascade every frame,
+    /// each following one half as often.
+    fn base_interval(cascade: usize) -> u32 {
+        1 << cascade.min(3)
+    }
+
+    /// Decide, for the already-updated `shadow_map`, which cascades need a
+    /// re-render this frame.
+    ///
+    /// `caster_signature` is any cheap hash of the shadow casters' transforms
+    /// (a wrapping sum of matrix bits is fine) — a change means geometry
+    /// moved. `importance` optionally stretches the refresh cadence of every
+    /// cascade using the importance map's suggested frequency, so off-screen
+    /// or low-importance regions refresh even less often.
+    ///
+    /// Cascades planned as [`CascadeUpdate::Reuse`] get their cached
+    /// view-projection written back into `shadow_map` so the sampling
+    /// uniforms match the cached texels.
+    pub fn plan(
+        &mut self,
+        shadow_map: &mut ShadowMap,
+        caster_signature: u64,
+        importance: Option<&crate::core::importance_map::ImportanceTileData>,
+    ) -> &[CascadeUpdate] {
+        let cascade_count = shadow_map.cascades.len();
+        self.entries.resize(cascade_count, CascadeCacheEntry::default());
+        self.plan.clear();
+
+        let light_changed =
+            self.light_direction.dot(shadow_map.light_direction) < LIGHT_DIR_EPSILON;
+        let casters_moved = self.caster_signature != caster_signature;
+        self.light_direction = shadow_map.light_direction;
+        self.caster_signature = caster_signature;
+
+        let importance_stretch = importance
+            .map(|tile| tile.suggested_update_frequency())
+            .unwrap_or(1);
+
+        for (i, cascade) in shadow_map.cascades.iter_mut().enumerate() {
+            let entry = &mut self.entries[i];
+            let interval = Self::base_interval(i).saturating_mul(importance_stretch);
+            let due = entry.frames_since_render + 1 >= interval;
+            let camera_moved = entry.view_proj != cascade.view_proj;
+            let changed = light_changed || casters_moved || camera_moved;
+
+            // Light rotation shifts every texel, so no cascade can be
+            // reused; everything else respects the cascade's cadence.
+            let render = !entry.valid || light_changed || (changed && due);
+
+            if render {
+                entry.view_proj = cascade.view_proj;
+                entry.split_depth = cascade.split_depth;
+                entry.valid = true;
+                entry.frames_since_render = 0;
+                self.plan.push(CascadeUpdate::Render);
+            } else {
+                cascade.view_proj = entry.view_proj;
+                cascade.split_depth = entry.split_depth;
+                entry.frames_since_render += 1;
+                self.plan.push(CascadeUpdate::Reuse);
+            }
+        }
+
+        &self.plan
+    }
+
+    /// Plan from the last [`CascadeCache::plan`] call.
+    pub fn last_plan(&self) -> &[CascadeUpdate] {
+        &self.plan
+    }
+
+    /// True once any cascade holds valid texels, i.e. the shadow image
+    /// contents must be preserved across the frame's layout transition.
+    pub fn any_valid(&self) -> bool {
+        self.entries.iter().any(|e| e.valid)
+    }
+
+    /// Drop all cached texels (resolution change, device loss, etc.).
+    pub fn invalidate(&mut self) {
+        for entry in &mut self.entries {
+            entry.valid = false;
+            entry.frames_since_render = 0;
+        }
+    }
+}
+
 /// PCF (Percentage Closer Filtering) helper
 pub fn pcf_sample_offsets(samples: u32) -> Vec<(f32, f32)> {
     let mut offsets = Vec::new();
@@ -332,3 +468,73 @@ pub fn calculate_shadow_factor(
     // This is a placeholder that returns fully lit
     1.0
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn planned(plan: &[CascadeUpdate]) -> Vec<bool> {
+        plan.iter().map(|u| *u == CascadeUpdate::Render).collect()
+    }
+
+    #[test]
+    fn static_scene_reuses_every_cascade() {
+        let mut shadow_map = ShadowMap::default();
+        let mut cache = CascadeCache::new();
+
+        // First frame: nothing cached, everything renders.
+        assert_eq!(planned(cache.plan(&mut shadow_map, 1, None)), vec![true; 4]);
+        // Nothing moved: all four cascades keep their texels.
+        assert_eq!(planned(cache.plan(&mut shadow_map, 1, None)), vec![false; 4]);
+        assert!(cache.any_valid());
+    }
+
+    #[test]
+    fn distant_cascades_refresh_at_reduced_cadence() {
+        let mut shadow_map = ShadowMap::default();
+        let mut cache = CascadeCache::new();
+        cache.plan(&mut shadow_map, 0, None);
+
+        let mut renders = [0u32; 4];
+        for frame in 1..=8u64 {
+            // Casters move every frame.
+            let plan = cache.plan(&mut shadow_map, frame, None).to_vec();
+            for (i, update) in plan.iter().enumerate() {
+                if *update == CascadeUpdate::Render {
+                    renders[i] += 1;
+                }
+            }
+        }
+
+        // Cascade 0 renders every frame; each following one half as often.
+        assert_eq!(renders, [8, 4, 2, 1]);
+    }
+
+    #[test]
+    fn light_rotation_invalidates_all_cascades() {
+        let mut shadow_map = ShadowMap::default();
+        let mut cache = CascadeCache::new();
+        cache.plan(&mut shadow_map, 0, None);
+
+        shadow_map.set_light_direction(Vec3::new(0.3, -1.0, 0.1));
+        shadow_map.update(Mat4::IDENTITY, Mat4::IDENTITY, 0.1, 100.0);
+        assert_eq!(planned(cache.plan(&mut shadow_map, 0, None)), vec![true; 4]);
+    }
+
+    #[test]
+    fn reuse_restores_cached_view_projection() {
+        let mut shadow_map = ShadowMap::default();
+        shadow_map.update(Mat4::IDENTITY, Mat4::IDENTITY, 0.1, 100.0);
+        let mut cache = CascadeCache::new();
+        cache.plan(&mut shadow_map, 0, None);
+        let cached = shadow_map.cascades[3].view_proj;
+
+        // A camera tweak changes the cascade matrix, but cascade 3 is not
+        // due yet — the cached matrix must come back so sampling matches
+        // the cached texels.
+        shadow_map.cascades[3].view_proj = Mat4::from_translation(Vec3::X);
+        let plan = cache.plan(&mut shadow_map, 0, None).to_vec();
+        assert_eq!(plan[3], CascadeUpdate::Reuse);
+        assert_eq!(shadow_map.cascades[3].view_proj, cached);
+    }
+}
@@ -0,0 +1,535 @@
+// =============================================================================
+// REACTOR Upload Engine — async transfer-queue uploads with a staging ring
+// =============================================================================
+// Replaces the allocate-a-staging-buffer-per-texture path: one persistent
+// host-visible ring buffer feeds batched copies that are submitted on the
+// dedicated transfer queue (discovered in core/context/builder.rs), with a
+// timeline semaphore marking completion. Consumers poll the timeline and only
+// publish bindless descriptors once the copy has actually finished, so level
+// streaming no longer stalls the graphics queue.
+//
+// Frame protocol:
+//   1. upload_image()/upload_buffer() any number of times — copies are
+//      recorded into one open batch, payload memcpy'd into the ring
+//   2. flush() — submits the batch on the transfer queue, signals timeline
+//   3. next frame: record_acquire_barriers(frame_cmd) then
+//      publish_ready(&mut registry) for every finished texture
+// =============================================================================
+
+use std::collections::VecDeque;
+use std::sync::{Arc, Mutex};
+
+use ash::vk;
+use gpu_allocator::vulkan::Allocator;
+use gpu_allocator::MemoryLocation;
+
+use crate::core::error::{ErrorCode, ReactorError, ReactorResult};
+use crate::core::VulkanContext;
+use crate::graphics::bindless::{BindlessRegistry, TextureHandle};
+use crate::graphics::buffer::Buffer;
+
+/// Copy-region alignment inside the staging ring. Covers
+/// `optimalBufferCopyOffsetAlignment` on every GPU we target.
+const STAGING_ALIGN: u64 = 256;
+
+/// Timeline value identifying one submitted upload batch. The upload is on
+/// the GPU once the engine's timeline counter reaches `value`.
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub struct UploadTicket {
+    value: u64,
+}
+
+/// Batch currently being recorded (not yet submitted).
+struct OpenBatch {
+    cmd: vk::CommandBuffer,
+    value: u64,
+}
+
+/// Batch submitted and owning ring space up to `ring_end`.
+struct InFlightBatch {
+    cmd: vk::CommandBuffer,
+    value: u64,
+    ring_end: u64,
+}
+
+/// Resource waiting for a queue-ownership acquire barrier on the graphics
+/// queue (only needed when the transfer family differs).
+enum PendingAcquire {
+    Image { image: vk::Image, mip_levels: u32, value: u64 },
+    Buffer { buffer: vk::Buffer, value: u64 },
+}
+
+/// Texture waiting for its copy to finish before the descriptor goes live.
+struct PendingPublish {
+    view: vk::ImageView,
+    value: u64,
+}
+
+pub struct UploadEngine {
+    device: ash::Device,
+    queue: vk::Queue,
+    queue_family: u32,
+    graphics_family: u32,
+    command_pool: vk::CommandPool,
+    staging: Buffer,
+    capacity: u64,
+    head: u64,
+    tail: u64,
+    timeline: vk::Semaphore,
+    next_value: u64,
+    open: Option<OpenBatch>,
+    in_flight: VecDeque<InFlightBatch>,
+    acquires: Vec<PendingAcquire>,
+    publishes: Vec<PendingPublish>,
+}
+
+impl UploadEngine {
+    /// `staging_capacity` bounds how much upload data can be in flight at
+    /// once; uploads beyond it block on the oldest batch. Falls back to the
+    /// graphics queue when the device has no dedicated transfer family.
+    pub fn new(
+        ctx: &VulkanContext,
+        allocator: Arc<Mutex<Allocator>>,
+        staging_capacity: u64,
+    ) -> ReactorResult<Self> {
+        let device = ctx.ash_device().clone();
+        let graphics_family = ctx.queue_family_index;
+        let (queue, queue_family) = match (ctx.transfer_queue, ctx.transfer_queue_family_index) {
+            (Some(q), Some(f)) => (q, f),
+            _ => (ctx.graphics_queue, graphics_family),
+        };
+
+        let pool_info = vk::CommandPoolCreateInfo::default()
+            .queue_family_index(queue_family)
+            .flags(vk::CommandPoolCreateFlags::RESET_COMMAND_BUFFER);
+        let command_pool = unsafe { device.create_command_pool(&pool_info, None)? };
+
+        let staging = Buffer::new(
+            ctx,
+            allocator,
+            staging_capacity,
+            vk::BufferUsageFlags::TRANSFER_SRC,
+            MemoryLocation::CpuToGpu,
+        )?;
+
+        let mut type_info = vk::SemaphoreTypeCreateInfo::default()
+            .semaphore_type(vk::SemaphoreType::TIMELINE)
+            .initial_value(0);
+        let sem_info = vk::SemaphoreCreateInfo::default().push_next(&mut type_info);
+        let timeline = unsafe { device.create_semaphore(&sem_info, None)? };
+
+        Ok(Self {
+            device,
+            queue,
+            queue_family,
+            graphics_family,
+            command_pool,
+            staging,
+            capacity: staging_capacity,
+            head: 0,
+            tail: 0,
+            timeline,
+            next_value: 1,
+            open: None,
+            in_flight: VecDeque::new(),
+            acquires: Vec::new(),
+            publishes: Vec::new(),
+        })
+    }
+
+    fn completed_value(&self) -> ReactorResult<u64> {
+        Ok(unsafe { self.device.get_semaphore_counter_value(self.timeline)? })
+    }
+
+    /// Release ring space owned by batches the GPU has finished.
+    fn reclaim(&mut self) -> ReactorResult<()> {
+        let completed = self.completed_value()?;
+        while let Some(batch) = self.in_flight.front() {
+            if batch.value > completed {
+                break;
+            }
+            let batch = self.in_flight.pop_front().unwrap();
+            self.tail = batch.ring_end;
+            unsafe {
+                self.device.free_command_buffers(self.command_pool, &[batch.cmd]);
+            }
+        }
+        if self.in_flight.is_empty() && self.open.is_none() {
+            self.head = 0;
+            self.tail = 0;
+        }
+        Ok(())
+    }
+
+    /// Block until the oldest in-flight batch finishes; used when the ring
+    /// is full. This is the backpressure point for oversized bursts.
+    fn wait_oldest(&mut self) -> ReactorResult<()> {
+        let value = match self.in_flight.front() {
+            Some(b) => b.value,
+            None => {
+                return Err(ReactorError::new(
+                    ErrorCode::ResourceLimit,
+                    "Upload exceeds staging ring capacity",
+                ))
+            }
+        };
+        let semaphores = [self.timeline];
+        let values = [value];
+        let wait_info = vk::SemaphoreWaitInfo::default()
+            .semaphores(&semaphores)
+            .values(&values);
+        unsafe { self.device.wait_semaphores(&wait_info, u64::MAX)? };
+        self.reclaim()
+    }
+
+    /// Reserve `size` contiguous bytes in the ring, waiting on the GPU only
+    /// when streaming outruns the ring.
+    fn allocate(&mut self, size: u64) -> ReactorResult<u64> {
+        let size = (size + STAGING_ALIGN - 1) & !(STAGING_ALIGN - 1);
+        if size > self.capacity {
+            return Err(ReactorError::new(
+                ErrorCode::ResourceLimit,
+                format!("Upload of {} bytes exceeds staging ring ({} bytes)", size, self.capacity),
+            ));
+        }
+        self.reclaim()?;
+        loop {
+            if self.head >= self.tail {
+                // Free space: [head, capacity) then [0, tail).
+                if self.capacity - self.head >= size {
+                    let offset = self.head;
+                    self.head += size;
+                    return Ok(offset);
+                }
+                if self.tail > size {
+                    self.head = size; // wrap; skipped bytes reclaimed with the batch
+                    return Ok(0);
+                }
+            } else if self.tail - self.head > size {
+                let offset = self.head;
+                self.head += size;
+                return Ok(offset);
+            }
+            self.wait_oldest()?;
+        }
+    }
+
+    fn batch_cmd(&mut self) -> ReactorResult<vk::CommandBuffer> {
+        if let Some(ref open) = self.open {
+            return Ok(open.cmd);
+        }
+        let alloc_info = vk::CommandBufferAllocateInfo::default()
+            .command_pool(self.command_pool)
+            .level(vk::CommandBufferLevel::PRIMARY)
+            .command_buffer_count(1);
+        let cmd = unsafe { self.device.allocate_command_buffers(&alloc_info)?[0] };
+        let begin_info = vk::CommandBufferBeginInfo::default()
+            .flags(vk::CommandBufferUsageFlags::ONE_TIME_SUBMIT);
+        unsafe { self.device.begin_command_buffer(cmd, &begin_info)? };
+        self.open = Some(OpenBatch { cmd, value: self.next_value });
+        Ok(cmd)
+    }
+
+    /// Stage `data` and record a copy into mip 0 of `image`. The image ends
+    /// the batch in SHADER_READ_ONLY_OPTIMAL (released to the graphics
+    /// family when the transfer queue is a separate family).
+    pub fn upload_image(
+        &mut self,
+        data: &[u8],
+        image: vk::Image,
+        width: u32,
+        height: u32,
+    ) -> ReactorResult<UploadTicket> {
+        let offset = self.allocate(data.len() as u64)?;
+        let mapped = self
+            .staging
+            .map::<u8>()
+            .ok_or_else(|| ReactorError::new(ErrorCode::OutOfMemory, "Staging ring not mapped"))?;
+        unsafe {
+            std::ptr::copy_nonoverlapping(data.as_ptr(), mapped.add(offset as usize), data.len());
+        }
+
+        let cmd = self.batch_cmd()?;
+        let value = self.open.as_ref().unwrap().value;
+        let range = vk::ImageSubresourceRange::default()
+            .aspect_mask(vk::ImageAspectFlags::COLOR)
+            .base_mip_level(0)
+            .level_count(1)
+            .base_array_layer(0)
+            .layer_count(1);
+
+        unsafe {
+            let to_dst = vk::ImageMemoryBarrier::default()
+                .old_layout(vk::ImageLayout::UNDEFINED)
+                .new_layout(vk::ImageLayout::TRANSFER_DST_OPTIMAL)
+                .src_queue_family_index(vk::QUEUE_FAMILY_IGNORED)
+                .dst_queue_family_index(vk::QUEUE_FAMILY_IGNORED)
+                .dst_access_mask(vk::AccessFlags::TRANSFER_WRITE)
+                .image(image)
+                .subresource_range(range);
+            self.device.cmd_pipeline_barrier(
+                cmd,
+                vk::PipelineStageFlags::TOP_OF_PIPE,
+                vk::PipelineStageFlags::TRANSFER,
+                vk::DependencyFlags::empty(),
+                &[],
+                &[],
+                &[to_dst],
+            );
+
+            let region = vk::BufferImageCopy::default()
+                .buffer_offset(offset)
+                .image_subresource(
+                    vk::ImageSubresourceLayers::default()
+                        .aspect_mask(vk::ImageAspectFlags::COLOR)
+                        .mip_level(0)
+                        .layer_count(1),
+                )
+                .image_extent(vk::Extent3D { width, height, depth: 1 });
+            self.device.cmd_copy_buffer_to_image(
+                cmd,
+                self.staging.handle,
+                image,
+                vk::ImageLayout::TRANSFER_DST_OPTIMAL,
+                &[region],
+            );
+
+            // Release to the graphics family (or plain layout transition when
+            // both queues share a family).
+            let (src_family, dst_family) = if self.queue_family != self.graphics_family {
+                (self.queue_family, self.graphics_family)
+            } else {
+                (vk::QUEUE_FAMILY_IGNORED, vk::QUEUE_FAMILY_IGNORED)
+            };
+            let release = vk::ImageMemoryBarrier::default()
+                .old_layout(vk::ImageLayout::TRANSFER_DST_OPTIMAL)
+                .new_layout(vk::ImageLayout::SHADER_READ_ONLY_OPTIMAL)
+                .src_queue_family_index(src_family)
+                .dst_queue_family_index(dst_family)
+                .src_access_mask(vk::AccessFlags::TRANSFER_WRITE)
+                .image(image)
+                .subresource_range(range);
+            self.device.cmd_pipeline_barrier(
+                cmd,
+                vk::PipelineStageFlags::TRANSFER,
+                vk::PipelineStageFlags::BOTTOM_OF_PIPE,
+                vk::DependencyFlags::empty(),
+                &[],
+                &[],
+                &[release],
+            );
+        }
+
+        if self.queue_family != self.graphics_family {
+            self.acquires.push(PendingAcquire::Image { image, mip_levels: 1, value });
+        }
+        Ok(UploadTicket { value })
+    }
+
+    /// Stage `data` and record a copy into `dst` at `dst_offset`.
+    pub fn upload_buffer(
+        &mut self,
+        data: &[u8],
+        dst: vk::Buffer,
+        dst_offset: u64,
+    ) -> ReactorResult<UploadTicket> {
+        let offset = self.allocate(data.len() as u64)?;
+        let mapped = self
+            .staging
+            .map::<u8>()
+            .ok_or_else(|| ReactorError::new(ErrorCode::OutOfMemory, "Staging ring not mapped"))?;
+        unsafe {
+            std::ptr::copy_nonoverlapping(data.as_ptr(), mapped.add(offset as usize), data.len());
+        }
+
+        let cmd = self.batch_cmd()?;
+        let value = self.open.as_ref().unwrap().value;
+        unsafe {
+            let region = vk::BufferCopy::default()
+                .src_offset(offset)
+                .dst_offset(dst_offset)
+                .size(data.len() as u64);
+            self.device.cmd_copy_buffer(cmd, self.staging.handle, dst, &[region]);
+
+            if self.queue_family != self.graphics_family {
+                let release = vk::BufferMemoryBarrier::default()
+                    .src_access_mask(vk::AccessFlags::TRANSFER_WRITE)
+                    .src_queue_family_index(self.queue_family)
+                    .dst_queue_family_index(self.graphics_family)
+                    .buffer(dst)
+                    .offset(dst_offset)
+                    .size(data.len() as u64);
+                self.device.cmd_pipeline_barrier(
+                    cmd,
+                    vk::PipelineStageFlags::TRANSFER,
+                    vk::PipelineStageFlags::BOTTOM_OF_PIPE,
+                    vk::DependencyFlags::empty(),
+                    &[],
+                    &[release],
+                    &[],
+                );
+                self.acquires.push(PendingAcquire::Buffer { buffer: dst, value });
+            } else {
+                let barrier = vk::MemoryBarrier::default()
+                    .src_access_mask(vk::AccessFlags::TRANSFER_WRITE)
+                    .dst_access_mask(vk::AccessFlags::MEMORY_READ);
+                self.device.cmd_pipeline_barrier(
+                    cmd,
+                    vk::PipelineStageFlags::TRANSFER,
+                    vk::PipelineStageFlags::ALL_COMMANDS,
+                    vk::DependencyFlags::empty(),
+                    &[barrier],
+                    &[],
+                    &[],
+                );
+            }
+        }
+        Ok(UploadTicket { value })
+    }
+
+    /// Defer a bindless publish until the texture's copy is done. Pair with
+    /// [`UploadEngine::publish_ready`].
+    pub fn publish_when_done(&mut self, ticket: UploadTicket, view: vk::ImageView) {
+        self.publishes.push(PendingPublish { view, value: ticket.value });
+    }
+
+    /// Submit the open batch on the transfer queue, signalling the timeline.
+    /// No-op when nothing was uploaded since the last flush.
+    pub fn flush(&mut self) -> ReactorResult<Option<UploadTicket>> {
+        let Some(open) = self.open.take() else {
+            return Ok(None);
+        };
+        unsafe { self.device.end_command_buffer(open.cmd)? };
+
+        let signal_values = [open.value];
+        let mut timeline_info =
+            vk::TimelineSemaphoreSubmitInfo::default().signal_semaphore_values(&signal_values);
+        let cmds = [open.cmd];
+        let signal_semaphores = [self.timeline];
+        let submit = vk::SubmitInfo::default()
+            .command_buffers(&cmds)
+            .signal_semaphores(&signal_semaphores)
+            .push_next(&mut timeline_info);
+        unsafe {
+            self.device
+                .queue_submit(self.queue, &[submit], vk::Fence::null())?
+        };
+
+        self.in_flight.push_back(InFlightBatch {
+            cmd: open.cmd,
+            value: open.value,
+            ring_end: self.head,
+        });
+        self.next_value += 1;
+        Ok(Some(UploadTicket { value: open.value }))
+    }
+
+    /// True once the batch behind `ticket` has fully executed.
+    pub fn is_complete(&self, ticket: UploadTicket) -> ReactorResult<bool> {
+        Ok(self.completed_value()? >= ticket.value)
+    }
+
+    /// Record queue-ownership acquire barriers on a graphics-queue command
+    /// buffer for every completed transfer. Call once per frame before any
+    /// newly streamed resource is sampled. No-op on single-queue devices.
+    pub fn record_acquire_barriers(&mut self, cmd: vk::CommandBuffer) -> ReactorResult<()> {
+        if self.acquires.is_empty() {
+            return Ok(());
+        }
+        let completed = self.completed_value()?;
+        let mut image_barriers = Vec::new();
+        let mut buffer_barriers = Vec::new();
+        self.acquires.retain(|acquire| match acquire {
+            PendingAcquire::Image { image, mip_levels, value } => {
+                if *value > completed {
+                    return true;
+                }
+                image_barriers.push(
+                    vk::ImageMemoryBarrier::default()
+                        .old_layout(vk::ImageLayout::TRANSFER_DST_OPTIMAL)
+                        .new_layout(vk::ImageLayout::SHADER_READ_ONLY_OPTIMAL)
+                        .src_queue_family_index(self.queue_family)
+                        .dst_queue_family_index(self.graphics_family)
+                        .dst_access_mask(vk::AccessFlags::SHADER_READ)
+                        .image(*image)
+                        .subresource_range(
+                            vk::ImageSubresourceRange::default()
+                                .aspect_mask(vk::ImageAspectFlags::COLOR)
+                                .level_count(*mip_levels)
+                                .layer_count(1),
+                        ),
+                );
+                false
+            }
+            PendingAcquire::Buffer { buffer, value } => {
+                if *value > completed {
+                    return true;
+                }
+                buffer_barriers.push(
+                    vk::BufferMemoryBarrier::default()
+                        .dst_access_mask(vk::AccessFlags::MEMORY_READ)
+                        .src_queue_family_index(self.queue_family)
+                        .dst_queue_family_index(self.graphics_family)
+                        .buffer(*buffer)
+                        .size(vk::WHOLE_SIZE),
+                );
+                false
+            }
+        });
+        if image_barriers.is_empty() && buffer_barriers.is_empty() {
+            return Ok(());
+        }
+        unsafe {
+            self.device.cmd_pipeline_barrier(
+                cmd,
+                vk::PipelineStageFlags::TOP_OF_PIPE,
+                vk::PipelineStageFlags::ALL_COMMANDS,
+                vk::DependencyFlags::empty(),
+                &[],
+                &buffer_barriers,
+                &image_barriers,
+            );
+        }
+        Ok(())
+    }
+
+    /// Register every texture whose copy has completed with the bindless
+    /// registry. Descriptors are never published for in-flight copies, so
+    /// shaders cannot sample half-uploaded textures.
+    pub fn publish_ready(
+        &mut self,
+        registry: &mut BindlessRegistry,
+    ) -> ReactorResult<Vec<(vk::ImageView, TextureHandle)>> {
+        if self.publishes.is_empty() {
+            return Ok(Vec::new());
+        }
+        let completed = self.completed_value()?;
+        let mut published = Vec::new();
+        let mut still_pending = Vec::new();
+        for pending in self.publishes.drain(..) {
+            if pending.value <= completed {
+                let handle = registry.register_texture(pending.view)?;
+                published.push((pending.view, handle));
+            } else {
+                still_pending.push(pending);
+            }
+        }
+        self.publishes = still_pending;
+        Ok(published)
+    }
+
+    pub fn pending_uploads(&self) -> usize {
+        self.in_flight.len() + usize::from(self.open.is_some())
+    }
+
+    pub fn destroy(&mut self) {
+        unsafe {
+            let _ = self.device.queue_wait_idle(self.queue);
+            self.device.destroy_semaphore(self.timeline, None);
+            self.device.destroy_command_pool(self.command_pool, None);
+        }
+        self.staging.destroy();
+        self.in_flight.clear();
+        self.open = None;
+    }
+}
@@ -1,5 +1,6 @@
 use glam::Vec2;
 use std::collections::HashSet;
+use std::time::Instant;
 use winit::event::{ElementState, MouseButton, WindowEvent};
 use winit::keyboard::{KeyCode, PhysicalKey};
 
@@ -16,6 +17,11 @@ pub struct Input {
     /// Subsistema de gamepad (Fase 5.5 — siempre presente, "desconectado"
     /// hasta que se enchufe un mando).
     gamepad: Gamepad,
+    /// Timestamp del último evento de input del OS (para medir latencia
+    /// evento→present).
+    last_event_at: Option<Instant>,
+    /// Timestamp del último `sample()` (ancla de la latencia input→present).
+    sampled_at: Option<Instant>,
 }
 
 impl Default for Input {
@@ -35,6 +41,8 @@ impl Input {
             mouse_delta: Vec2::ZERO,
             scroll_delta: 0.0,
             gamepad: Gamepad::new(),
+            last_event_at: None,
+            sampled_at: None,
         }
     }
 
@@ -49,6 +57,15 @@ impl Input {
     }
 
     pub fn process_event(&mut self, event: &WindowEvent) {
+        if matches!(
+            event,
+            WindowEvent::KeyboardInput { .. }
+                | WindowEvent::MouseInput { .. }
+                | WindowEvent::CursorMoved { .. }
+                | WindowEvent::MouseWheel { .. }
+        ) {
+            self.last_event_at = Some(Instant::now());
+        }
         match event {
             WindowEvent::KeyboardInput {
                 event:
@@ -95,6 +112,26 @@ impl Input {
         }
     }
 
+    /// Muestreo diferido justo antes de la simulación: re-pollea el gamepad
+    /// para que el frame use el estado más fresco posible, y marca el
+    /// timestamp que ancla la medición de latencia input→present.
+    pub fn sample(&mut self) -> Instant {
+        self.gamepad.poll();
+        let now = Instant::now();
+        self.sampled_at = Some(now);
+        now
+    }
+
+    /// Timestamp del último `sample()`.
+    pub fn sampled_at(&self) -> Option<Instant> {
+        self.sampled_at
+    }
+
+    /// Timestamp del último evento de input recibido del OS.
+    pub fn last_event_at(&self) -> Option<Instant> {
+        self.last_event_at
+    }
+
     // Keyboard
     pub fn is_key_down(&self, key: KeyCode) -> bool {
         self.pressed_keys.contains(&key)
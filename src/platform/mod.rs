@@ -9,5 +9,5 @@ pub mod window;
 
 pub use gamepad::{Gamepad, GamepadAxis, GamepadButton};
 pub use input::Input;
-pub use time::Time;
+pub use time::{FramePacer, FramePacingStats, Time};
 pub use window::ReactorWindow;
@@ -6,7 +6,10 @@ pub mod context;
 pub mod pipeline;
 pub mod shader_binding_table;
 
-pub use acceleration_structure::{AccelerationStructure, Blas, Tlas};
+pub use acceleration_structure::{
+    buffer_device_address, AccelerationStructure, Blas, BlasBatchBuilder, BlasGeometry, Tlas,
+    TlasInstance,
+};
 pub use context::RayTracingContext;
 pub use pipeline::RayTracingPipeline;
 pub use shader_binding_table::ShaderBindingTable;
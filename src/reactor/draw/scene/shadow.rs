@@ -1,7 +1,25 @@
+use crate::graphics::shadows::CascadeUpdate;
 use crate::reactor::Reactor;
 use crate::systems::scene::Scene;
 use ash::vk;
 
+/// Cheap signature of the shadow casters: a wrapping sum of transform bits.
+/// Any caster moving, appearing or disappearing changes the value.
+fn caster_signature(scene: &Scene) -> u64 {
+    let mut signature = 0u64;
+    for object in &scene.objects {
+        if !object.visible {
+            continue;
+        }
+        for value in object.transform.to_cols_array() {
+            signature = signature
+                .rotate_left(7)
+                .wrapping_add(value.to_bits() as u64);
+        }
+    }
+    signature
+}
+
 impl Reactor {
     pub(super) fn render_shadow_cascades(&mut self, scene: &Scene, command_buffer: vk::CommandBuffer) {
         if self.shadow_map.is_none() || self.shadow_pipeline.is_none() {
@@ -14,6 +32,8 @@ impl Reactor {
         let shadow_pipe;
         let sun_dir;
 
+        let plan;
+        let had_cached_texels = self.shadow_cascade_cache.any_valid();
         {
             let shadow_map = self.shadow_map.as_mut().unwrap();
             sun_dir = scene.sun_direction;
@@ -22,15 +42,37 @@ impl Reactor {
             cascade_count = shadow_map.config.cascade_count;
             shadow_resolution = shadow_map.config.resolution as f32;
 
+            // Decide which cascades actually need a re-render; reused ones
+            // get their cached view-projection restored before the uniforms
+            // are written, so sampling matches the cached texels.
+            plan = self
+                .shadow_cascade_cache
+                .plan(shadow_map, caster_signature(scene), None)
+                .to_vec();
+
             let shadow_uniform = crate::graphics::shadows::ShadowUniformData::from_shadow_map(shadow_map);
             self.shadow_uniform_buffers[self.current_frame].write(&[shadow_uniform]);
         }
 
+        if plan.iter().all(|update| *update == CascadeUpdate::Reuse) {
+            // Every cascade keeps its texels; the image already sits in
+            // SHADER_READ_ONLY_OPTIMAL from the frame that rendered it.
+            return;
+        }
+
         shadow_img = self.shadow_image.unwrap();
         shadow_pipe = self.shadow_pipeline.as_ref().unwrap();
 
+        // Preserve cached layers once any cascade holds valid texels;
+        // UNDEFINED would let the driver discard them.
+        let old_layout = if had_cached_texels {
+            vk::ImageLayout::SHADER_READ_ONLY_OPTIMAL
+        } else {
+            vk::ImageLayout::UNDEFINED
+        };
+
         let shadow_start_barrier = vk::ImageMemoryBarrier::default()
-            .old_layout(vk::ImageLayout::UNDEFINED)
+            .old_layout(old_layout)
             .new_layout(vk::ImageLayout::DEPTH_STENCIL_ATTACHMENT_OPTIMAL)
             .src_access_mask(vk::AccessFlags::empty())
             .dst_access_mask(vk::AccessFlags::DEPTH_STENCIL_ATTACHMENT_WRITE)
@@ -46,6 +88,13 @@ impl Reactor {
         }
 
         for layer in 0..cascade_count {
+            if plan
+                .get(layer as usize)
+                .is_some_and(|update| *update == CascadeUpdate::Reuse)
+            {
+                continue;
+            }
+
             let depth_attachment = vk::RenderingAttachmentInfo::default()
                 .image_view(self.shadow_image_views[layer as usize])
                 .image_layout(vk::ImageLayout::DEPTH_STENCIL_ATTACHMENT_OPTIMAL)
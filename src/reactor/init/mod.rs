@@ -397,6 +397,7 @@ impl Reactor {
             depth_format,
             ibl_textures: None,
             shadow_map: None,
+            shadow_cascade_cache: crate::graphics::shadows::CascadeCache::new(),
             shadow_image: None,
             shadow_image_views: Vec::new(),
             shadow_array_view: None,
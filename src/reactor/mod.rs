@@ -114,6 +114,7 @@ pub struct Reactor {
 
     // ── Cascaded Shadow Maps (CSM) ──
     pub shadow_map: Option<crate::graphics::shadows::ShadowMap>,
+    pub shadow_cascade_cache: crate::graphics::shadows::CascadeCache,
     pub shadow_image: Option<vk::Image>,
     pub shadow_image_views: Vec<vk::ImageView>,
     pub shadow_array_view: Option<vk::ImageView>,
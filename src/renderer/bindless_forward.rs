@@ -62,6 +62,8 @@ use crate::core::error::ReactorResult;
 use crate::graphics::bindless::{
     BindlessConfig, BindlessRegistry, BindlessStats, MaterialHandle, MeshHandle, TextureHandle,
 };
+use crate::graphics::indirect::{DrawIndexedIndirectCommand, IndirectCommandWithMaterial, IndirectDrawBuffer};
+use crate::graphics::mesh_shader::MeshShaderPipeline;
 use crate::graphics::pso_cache::{CachedPipeline, PsoCache};
 use crate::graphics::pso_hash::PsoHash;
 use crate::graphics::shader_compiler::{CompiledShader, ShaderCompiler, ShaderStage};
@@ -126,6 +128,41 @@ pub struct RenderObject {
     pub transform_index: u32,
 }
 
+/// Parámetros de draw de un mesh registrado, usados para construir los
+/// comandos indirectos del frame. Se registran una vez junto al slot bindless.
+#[derive(Debug, Clone, Copy, Default)]
+pub struct MeshDrawInfo {
+    pub index_count: u32,
+    pub first_index: u32,
+    pub vertex_offset: i32,
+}
+
+/// Rango de meshlets cocidos de un mesh dentro de los buffers globales de
+/// meshlets (ver `MeshletMesh`). Habilita el camino de mesh shaders.
+#[derive(Debug, Clone, Copy, Default)]
+pub struct MeshletDrawInfo {
+    pub first_meshlet: u32,
+    pub meshlet_count: u32,
+}
+
+/// Push constants del camino de meshlets. Coincide con `meshlet.task` /
+/// `meshlet.mesh` en shaders/reactor/meshlet/.
+///
+/// 192 bytes: dentro del límite de las GPUs con EXT_mesh_shader (todas
+/// reportan >= 256 bytes de push constants).
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct MeshletPushConstants {
+    pub view_proj: [[f32; 4]; 4],
+    /// xyz = normal, w = distancia (world space).
+    pub frustum_planes: [[f32; 4]; 6],
+    pub camera_position: [f32; 4],
+    pub first_meshlet: u32,
+    pub meshlet_count: u32,
+    pub transform_index: u32,
+    pub material_index: u32,
+}
+
 // ═══════════════════════════════════════════════════════════════════════════
 // BindlessForwardRenderer
 // ═══════════════════════════════════════════════════════════════════════════
@@ -149,9 +186,20 @@ pub struct BindlessForwardRenderer {
     transform_buffer: Option<vk::Buffer>,
     transform_buffer_size: u64,
 
+    /// Parámetros de draw por mesh slot (indexado por `MeshHandle`).
+    mesh_draw_info: Vec<MeshDrawInfo>,
+
+    /// Rango de meshlets por mesh slot (camino de mesh shaders).
+    meshlet_draw_info: Vec<MeshletDrawInfo>,
+
+    /// Pipeline task/mesh/fragment para el camino de meshlets.
+    meshlet_pipeline: Option<MeshShaderPipeline>,
+
     // ── Frame state ───────────────────────────────────────────────────
     /// Objetos enviados por el gameplay para este frame.
     frame_objects: Vec<RenderObject>,
+    /// Objetos que se dibujan por el camino de meshlets este frame.
+    frame_meshlet_objects: Vec<RenderObject>,
     /// Transforms actualizadas este frame.
     frame_transforms: Vec<Mat4>,
 
@@ -164,6 +212,8 @@ pub struct FrameStats {
     pub total_objects: u32,
     pub visible_objects: u32,
     pub draw_calls: u32,
+    /// Comandos escritos al buffer indirecto (tras merge de instancias).
+    pub indirect_commands: u32,
     pub pso_cache_hits: u32,
     pub pso_cache_misses: u32,
     pub shaders_reloaded: u32,
@@ -219,7 +269,11 @@ impl BindlessForwardRenderer {
             default_fragment_shader: None,
             transform_buffer: None,
             transform_buffer_size: 0,
+            mesh_draw_info: Vec::new(),
+            meshlet_draw_info: Vec::new(),
+            meshlet_pipeline: None,
             frame_objects: Vec::with_capacity(4096),
+            frame_meshlet_objects: Vec::with_capacity(1024),
             frame_transforms: Vec::with_capacity(4096),
             last_frame_stats: FrameStats::default(),
         })
@@ -253,6 +307,21 @@ impl BindlessForwardRenderer {
     /// Libera un slot de mesh.
     pub fn free_mesh_slot(&mut self, handle: MeshHandle) {
         self.bindless.free_mesh_slot(handle);
+        if let Some(info) = self.mesh_draw_info.get_mut(handle.index() as usize) {
+            *info = MeshDrawInfo::default();
+        }
+    }
+
+    /// Registra los parámetros de draw de un mesh (index count + offsets en
+    /// los buffers globales). Necesario para que `end_frame_indirect` pueda
+    /// construir los comandos indirectos del frame.
+    pub fn set_mesh_draw_info(&mut self, mesh: MeshHandle, info: MeshDrawInfo) {
+        let idx = mesh.index() as usize;
+        if idx >= self.mesh_draw_info.len() {
+            self.mesh_draw_info
+                .resize(idx + 1, MeshDrawInfo::default());
+        }
+        self.mesh_draw_info[idx] = info;
     }
 
     /// Libera un slot de material.
@@ -260,6 +329,30 @@ impl BindlessForwardRenderer {
         self.bindless.free_material_slot(handle);
     }
 
+    /// Registra el rango de meshlets cocidos de un mesh. Los meshes con
+    /// rango registrado pueden enviarse con `submit_meshlet_object` para
+    /// dibujarse por el camino de mesh shaders.
+    pub fn set_mesh_meshlet_info(&mut self, mesh: MeshHandle, info: MeshletDrawInfo) {
+        let idx = mesh.index() as usize;
+        if idx >= self.meshlet_draw_info.len() {
+            self.meshlet_draw_info
+                .resize(idx + 1, MeshletDrawInfo::default());
+        }
+        self.meshlet_draw_info[idx] = info;
+    }
+
+    /// Instala el pipeline task/mesh/fragment del camino de meshlets
+    /// (creado con `MeshShaderPipeline::new` cuando el device soporta
+    /// EXT_mesh_shader).
+    pub fn set_meshlet_pipeline(&mut self, pipeline: MeshShaderPipeline) {
+        self.meshlet_pipeline = Some(pipeline);
+    }
+
+    /// ¿Está habilitado el camino de meshlets?
+    pub fn has_meshlet_pipeline(&self) -> bool {
+        self.meshlet_pipeline.is_some()
+    }
+
     // ═════════════════════════════════════════════════════════════════
     // Shader Management
     // ═════════════════════════════════════════════════════════════════
@@ -319,6 +412,7 @@ impl BindlessForwardRenderer {
     /// Inicia un nuevo frame. Limpia el estado del frame anterior.
     pub fn begin_frame(&mut self) {
         self.frame_objects.clear();
+        self.frame_meshlet_objects.clear();
         self.frame_transforms.clear();
     }
 
@@ -342,6 +436,117 @@ impl BindlessForwardRenderer {
         self.frame_objects.extend_from_slice(objects);
     }
 
+    /// Envía un objeto por el camino de meshlets. Requiere que el mesh tenga
+    /// rango de meshlets registrado y que haya pipeline instalado; si no,
+    /// cae al camino clásico de vertex shading.
+    #[inline]
+    pub fn submit_meshlet_object(
+        &mut self,
+        mesh: MeshHandle,
+        material: MaterialHandle,
+        transform_index: u32,
+    ) {
+        let has_meshlets = self
+            .meshlet_draw_info
+            .get(mesh.index() as usize)
+            .is_some_and(|info| info.meshlet_count > 0);
+        if self.meshlet_pipeline.is_some() && has_meshlets {
+            self.frame_meshlet_objects
+                .push(RenderObject { mesh, material, transform_index });
+        } else {
+            self.submit_object(mesh, material, transform_index);
+        }
+    }
+
+    /// Graba los draws del camino de meshlets.
+    ///
+    /// Por objeto: push constants (matrices + planos de frustum + rango de
+    /// meshlets) y un `vkCmdDrawMeshTasksEXT` con un workgroup de task shader
+    /// por cada 32 meshlets. El task shader culled por frustum y cono de
+    /// backface; los supervivientes se expanden en el mesh shader.
+    ///
+    /// `meshlet_set` es el descriptor set (set = 1) con los buffers globales
+    /// de meshlets, remapeo de vértices, triángulos, vértices y transforms.
+    /// Retorna la cantidad de objetos dibujados.
+    pub fn record_meshlet_draws(
+        &self,
+        cmd: vk::CommandBuffer,
+        mesh_ext: &ash::ext::mesh_shader::Device,
+        meshlet_set: vk::DescriptorSet,
+        view_proj: Mat4,
+        camera_position: glam::Vec3,
+        frustum: &crate::systems::Frustum,
+    ) -> u32 {
+        let Some(ref pipeline) = self.meshlet_pipeline else {
+            return 0;
+        };
+        if self.frame_meshlet_objects.is_empty() {
+            return 0;
+        }
+
+        let mut frustum_planes = [[0.0f32; 4]; 6];
+        for (dst, plane) in frustum_planes.iter_mut().zip(frustum.planes.iter()) {
+            *dst = [plane.normal.x, plane.normal.y, plane.normal.z, plane.distance];
+        }
+
+        unsafe {
+            self.device.cmd_bind_pipeline(
+                cmd,
+                vk::PipelineBindPoint::GRAPHICS,
+                pipeline.pipeline(),
+            );
+            self.device.cmd_bind_descriptor_sets(
+                cmd,
+                vk::PipelineBindPoint::GRAPHICS,
+                pipeline.layout(),
+                0,
+                &[self.bindless.descriptor_set(), meshlet_set],
+                &[],
+            );
+        }
+
+        let mut drawn = 0u32;
+        for obj in &self.frame_meshlet_objects {
+            let Some(info) = self.meshlet_draw_info.get(obj.mesh.index() as usize) else {
+                continue;
+            };
+
+            let push = MeshletPushConstants {
+                view_proj: view_proj.to_cols_array_2d(),
+                frustum_planes,
+                camera_position: [camera_position.x, camera_position.y, camera_position.z, 0.0],
+                first_meshlet: info.first_meshlet,
+                meshlet_count: info.meshlet_count,
+                transform_index: obj.transform_index,
+                material_index: obj.material.index(),
+            };
+            let push_bytes = unsafe {
+                std::slice::from_raw_parts(
+                    &push as *const MeshletPushConstants as *const u8,
+                    std::mem::size_of::<MeshletPushConstants>(),
+                )
+            };
+
+            // Un workgroup de task shader por cada 32 meshlets.
+            let group_count = info.meshlet_count.div_ceil(32);
+            unsafe {
+                self.device.cmd_push_constants(
+                    cmd,
+                    pipeline.layout(),
+                    vk::ShaderStageFlags::TASK_EXT
+                        | vk::ShaderStageFlags::MESH_EXT
+                        | vk::ShaderStageFlags::FRAGMENT,
+                    0,
+                    push_bytes,
+                );
+                mesh_ext.cmd_draw_mesh_tasks(cmd, group_count, 1, 1);
+            }
+            drawn += 1;
+        }
+
+        drawn
+    }
+
     /// Finaliza el frame y retorna estadísticas.
     ///
     /// **Nota**: El rendering real (command buffer recording) se hace
@@ -372,12 +577,91 @@ impl BindlessForwardRenderer {
             pso_cache_hits: 0,
             pso_cache_misses: 0,
             shaders_reloaded,
+            indirect_commands: 0,
         };
 
         self.last_frame_stats = stats;
         stats
     }
 
+    /// Finaliza el frame construyendo los draw commands batcheados en un
+    /// `IndirectDrawBuffer`, listo para un único multi-draw-indirect.
+    ///
+    /// Los objetos del frame se ordenan por (mesh, material) y las corridas
+    /// de objetos idénticos con transforms contiguas se colapsan en un solo
+    /// comando instanciado (`instance_count > 1`, el shader indexa transforms
+    /// con `gl_InstanceIndex`, que en Vulkan ya incluye `firstInstance`).
+    /// El resto queda como un
+    /// comando por objeto, pero todos se emiten con una sola llamada:
+    ///
+    /// ```rust,ignore
+    /// renderer.end_frame_indirect(&mut indirect)?;
+    /// // ... bind pipeline + descriptor set bindless ...
+    /// indirect.record_draw(cmd);
+    /// ```
+    pub fn end_frame_indirect(
+        &mut self,
+        indirect: &mut IndirectDrawBuffer,
+    ) -> ReactorResult<FrameStats> {
+        // Hot-reload + stats base del camino normal.
+        let mut stats = self.end_frame();
+
+        // Orden estable por estado: mesh primero (cambia index ranges),
+        // material después (solo cambia índices bindless).
+        self.frame_objects
+            .sort_unstable_by_key(|o| ((o.mesh.index() as u64) << 32) | o.material.index() as u64);
+
+        indirect.reset();
+        let mut commands: u32 = 0;
+        let mut last: Option<IndirectCommandWithMaterial> = None;
+
+        for obj in &self.frame_objects {
+            let Some(info) = self.mesh_draw_info.get(obj.mesh.index() as usize) else {
+                continue;
+            };
+            if info.index_count == 0 {
+                continue;
+            }
+
+            // Merge: mismo mesh + material y transform contigua → instancia.
+            if let Some(ref mut cmd) = last {
+                if cmd.material_index == obj.material.index()
+                    && cmd.cmd.first_index == info.first_index
+                    && cmd.cmd.vertex_offset == info.vertex_offset
+                    && obj.transform_index == cmd.cmd.first_instance + cmd.cmd.instance_count
+                {
+                    cmd.cmd.instance_count += 1;
+                    continue;
+                }
+            }
+
+            if let Some(cmd) = last.take() {
+                indirect.push(cmd)?;
+                commands += 1;
+            }
+            last = Some(IndirectCommandWithMaterial {
+                cmd: DrawIndexedIndirectCommand {
+                    index_count: info.index_count,
+                    instance_count: 1,
+                    first_index: info.first_index,
+                    vertex_offset: info.vertex_offset,
+                    first_instance: obj.transform_index,
+                },
+                material_index: obj.material.index(),
+                transform_index: obj.transform_index,
+            });
+        }
+        if let Some(cmd) = last.take() {
+            indirect.push(cmd)?;
+            commands += 1;
+        }
+
+        stats.indirect_commands = commands;
+        stats.draw_calls = if commands > 0 { 1 } else { 0 };
+        self.last_frame_stats = stats;
+        Ok(stats)
+    }
+
     // ═════════════════════════════════════════════════════════════════
     // Accessors
     // ═════════════════════════════════════════════════════════════════
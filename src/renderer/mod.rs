@@ -9,6 +9,7 @@ pub mod forward;
 // pub mod postprocess; // Fase 4
 
 pub use bindless_forward::{
-    BindlessForwardConfig, BindlessForwardRenderer, FrameStats, RenderObject,
+    BindlessForwardConfig, BindlessForwardRenderer, FrameStats, MeshDrawInfo, MeshletDrawInfo,
+    MeshletPushConstants, RenderObject,
 };
 pub use forward::ForwardRenderer;
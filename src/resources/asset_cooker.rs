@@ -6,12 +6,14 @@
 // in the persistent AssetDatabase.
 // =============================================================================
 
-use std::collections::HashMap;
+use std::collections::{HashMap, HashSet};
 use std::fs;
 use std::io::Write;
 use std::path::{Path, PathBuf};
+use std::sync::{Arc, Mutex};
 
 use crate::core::error::{ReactorError, ReactorResult};
+use crate::core::jobs;
 use crate::resources::asset_database::{AssetDatabase, AssetMetadata, AssetType};
 use crate::resources::asset_id::AssetId;
 
@@ -54,8 +56,169 @@ impl AssetCooker {
         Ok(())
     }
 
+    /// Incremental parallel cook with default worker budgets.
+    pub fn cook_all_incremental(&mut self) -> ReactorResult<CookStats> {
+        self.cook_all_incremental_with(CookBudgets::default())
+    }
+
+    /// Incremental parallel cook.
+    ///
+    /// 1. Content-hash every candidate in parallel (xxh3, IO-bound).
+    /// 2. Skip assets whose hash matches the database, then pull in anything
+    ///    downstream of a changed asset via the recorded dependency graph.
+    /// 3. Cook the dirty remainder across worker threads, budgeted per asset
+    ///    class so texture compression (the long pole) can't starve the rest.
+    /// 4. Register results serially; per-file failures are reported in the
+    ///    stats instead of aborting the whole cook.
+    pub fn cook_all_incremental_with(&mut self, budgets: CookBudgets) -> ReactorResult<CookStats> {
+        // ── Phase 1: gather candidates ──
+        let mut candidates: Vec<(PathBuf, AssetType, AssetId)> = Vec::new();
+        for entry in walkdir::WalkDir::new(&self.input_dir)
+            .into_iter()
+            .filter_map(|e| e.ok())
+        {
+            if !entry.file_type().is_file() {
+                continue;
+            }
+            let path = entry.path();
+            let ext = path.extension().and_then(|e| e.to_str()).unwrap_or("");
+            let asset_type = AssetType::from_extension(ext);
+            if asset_type == AssetType::Unknown {
+                continue;
+            }
+            let relative = path.strip_prefix(&self.input_dir).map_err(|e| {
+                ReactorError::asset_load(format!("Invalid path structure: {}", e))
+            })?;
+            candidates.push((path.to_path_buf(), asset_type, AssetId::from_path(relative)));
+        }
+
+        // ── Phase 2: hash contents in parallel ──
+        // Unreadable files hash to None and are treated as changed so the
+        // cook step surfaces the real IO error.
+        let hashes: Vec<(AssetId, Option<u64>)> = jobs::parallel_reduce(
+            &candidates,
+            Vec::new,
+            |mut acc: Vec<(AssetId, Option<u64>)>, (path, _, id)| {
+                let hash = fs::read(path).ok().map(|c| xxhash_rust::xxh3::xxh3_64(&c));
+                acc.push((*id, hash));
+                acc
+            },
+            |mut a, mut b| {
+                a.append(&mut b);
+                a
+            },
+        );
+
+        // ── Phase 3: dirty set = hash mismatches + their transitive dependents ──
+        let known: HashMap<AssetId, AssetMetadata> = self.db.list_assets()?.into_iter().collect();
+        let mut dirty: HashSet<AssetId> = hashes
+            .iter()
+            .filter(|(id, hash)| match (known.get(id), hash) {
+                (Some(meta), Some(hash)) => meta.content_hash != *hash,
+                _ => true,
+            })
+            .map(|(id, _)| *id)
+            .collect();
+
+        let mut frontier: Vec<AssetId> = dirty.iter().copied().collect();
+        while let Some(id) = frontier.pop() {
+            if let Some(meta) = known.get(&id) {
+                for &dependent in &meta.dependents {
+                    if dirty.insert(dependent) {
+                        frontier.push(dependent);
+                    }
+                }
+            }
+        }
+
+        let mut stats = CookStats::default();
+        let mut work: Vec<usize> = Vec::new();
+        for (i, (_, _, id)) in candidates.iter().enumerate() {
+            if dirty.contains(id) {
+                work.push(i);
+            } else {
+                stats.skipped += 1;
+            }
+        }
+
+        if work.is_empty() {
+            return Ok(stats);
+        }
+
+        // ── Phase 4: cook dirty assets with per-class worker budgets ──
+        let cooker: &AssetCooker = &*self;
+        let results: Mutex<Vec<(usize, ReactorResult<Option<(AssetId, AssetMetadata)>>)>> =
+            Mutex::new(Vec::with_capacity(work.len()));
+
+        let mut groups: Vec<(Vec<usize>, usize)> = vec![
+            (Vec::new(), budgets.texture.max(1)),
+            (Vec::new(), budgets.model.max(1)),
+            (Vec::new(), budgets.other.max(1)),
+        ];
+        for &i in &work {
+            let group = match candidates[i].1 {
+                AssetType::Texture => 0,
+                AssetType::Model => 1,
+                _ => 2,
+            };
+            groups[group].0.push(i);
+        }
+
+        jobs::scope(|s| {
+            for (items, budget) in &groups {
+                if items.is_empty() {
+                    continue;
+                }
+                let queue = Arc::new(Mutex::new(items.clone()));
+                for _ in 0..*budget {
+                    let queue = Arc::clone(&queue);
+                    let results = &results;
+                    let candidates = &candidates;
+                    s.spawn(move |_| loop {
+                        let Some(i) = queue.lock().unwrap().pop() else {
+                            break;
+                        };
+                        let result = cooker.cook_payload(&candidates[i].0);
+                        results.lock().unwrap().push((i, result));
+                    });
+                }
+            }
+        });
+
+        // ── Phase 5: register in one batch (one sled transaction + flush) ──
+        let mut batch: Vec<(AssetId, AssetMetadata)> = Vec::new();
+        for (i, result) in results.into_inner().unwrap() {
+            match result {
+                Ok(Some((asset_id, meta))) => {
+                    batch.push((asset_id, meta));
+                    stats.cooked += 1;
+                }
+                Ok(None) => stats.skipped += 1,
+                Err(e) => {
+                    eprintln!("❌ Failed to cook {}: {}", candidates[i].0.display(), e);
+                    stats.failed += 1;
+                }
+            }
+        }
+        if !batch.is_empty() {
+            self.db.register_assets(batch)?;
+        }
+
+        Ok(stats)
+    }
+
     /// Cook a single asset file
     pub fn cook_file(&mut self, path: &Path) -> ReactorResult<()> {
+        if let Some((asset_id, meta)) = self.cook_payload(path)? {
+            self.db.register_asset(asset_id, meta)?;
+        }
+        Ok(())
+    }
+
+    /// Cook one asset to its runtime format without touching the database.
+    /// Takes `&self` so the incremental pipeline can fan cooks out across
+    /// worker threads; registration stays on the caller's thread.
+    fn cook_payload(&self, path: &Path) -> ReactorResult<Option<(AssetId, AssetMetadata)>> {
         let relative_path = path
             .strip_prefix(&self.input_dir)
             .map_err(|e| ReactorError::asset_load(format!("Invalid path structure: {}", e)))?;
@@ -65,7 +228,7 @@ impl AssetCooker {
         let asset_type = AssetType::from_extension(ext);
         if asset_type == AssetType::Unknown {
             // Skip unknown file types (e.g. system files)
-            return Ok(());
+            return Ok(None);
         }
 
         let path_str = relative_path.to_string_lossy().replace('\\', "/");
@@ -191,19 +354,8 @@ impl AssetCooker {
                         ReactorError::asset_load(format!("Failed to parse model file: {}", e))
                     })?;
 
-                let mut file = fs::File::create(&dest_path)?;
-                file.write_all(b"RTMH")?;
-                file.write_all(&1u32.to_le_bytes())?; // Version
-                file.write_all(&(vertices.len() as u32).to_le_bytes())?;
-                file.write_all(&(indices.len() as u32).to_le_bytes())?;
-
-                // Write vertex bytes directly (fast memory cast)
-                let vertex_bytes = bytemuck::cast_slice::<crate::resources::Vertex, u8>(&vertices);
-                file.write_all(vertex_bytes)?;
-
-                // Write index bytes directly
-                let index_bytes = bytemuck::cast_slice::<u32, u8>(&indices);
-                file.write_all(index_bytes)?;
+                // RTMH layout lives in cooked_mesh.rs (shared with the runtime reader)
+                crate::resources::cooked_mesh::CookedMesh::write_to(&dest_path, &vertices, &indices)?;
 
                 extra.insert(
                     "vertex_count".to_string(),
@@ -260,7 +412,6 @@ impl AssetCooker {
             }
         }
 
-        // Write metadata info to the sled AssetDatabase
         let meta = AssetMetadata {
             source_path: path_str,
             content_hash: hash,
@@ -274,8 +425,62 @@ impl AssetCooker {
             extra,
         };
 
-        self.db.register_asset(asset_id, meta)?;
+        Ok(Some((asset_id, meta)))
+    }
 
-        Ok(())
+    /// Bundle every cooked asset registered in the database into a single
+    /// memory-mappable pack file. Run after `cook_all()`; shipping builds
+    /// load from the pack instead of the loose cooked files.
+    pub fn write_pack<P: AsRef<Path>>(&self, pack_path: P) -> ReactorResult<usize> {
+        let mut writer = crate::resources::asset_pack::AssetPackWriter::create(&pack_path)?;
+
+        for (id, meta) in self.db.list_assets()? {
+            let cooked_name = format!("{:016x}.{}", id.as_u64(), meta.asset_type.extension());
+            let cooked_path = self.output_dir.join(&cooked_name);
+            let blob = fs::read(&cooked_path).map_err(|e| {
+                ReactorError::new(
+                    crate::core::error::ErrorCode::IoError,
+                    format!("Failed to read cooked asset '{}': {}", cooked_path.display(), e),
+                )
+            })?;
+            writer.add(id, &blob)?;
+        }
+
+        let count = writer.entry_count();
+        writer.finish()?;
+        println!("📦 Packed {} cooked assets into {}", count, pack_path.as_ref().display());
+        Ok(count)
+    }
+}
+
+/// Result counters from an incremental cook.
+#[derive(Clone, Copy, Debug, Default)]
+pub struct CookStats {
+    pub cooked: usize,
+    pub skipped: usize,
+    pub failed: usize,
+}
+
+/// Worker threads granted to each asset class during a parallel cook.
+/// Texture compression dominates cook time, so it gets the bulk of the
+/// machine by default; models and everything else keep a couple of workers
+/// so small assets still finish while textures grind.
+#[derive(Clone, Copy, Debug)]
+pub struct CookBudgets {
+    pub texture: usize,
+    pub model: usize,
+    pub other: usize,
+}
+
+impl Default for CookBudgets {
+    fn default() -> Self {
+        let cores = std::thread::available_parallelism()
+            .map(|n| n.get())
+            .unwrap_or(4);
+        Self {
+            texture: cores.saturating_sub(2).max(1),
+            model: 2,
+            other: 1,
+        }
     }
 }
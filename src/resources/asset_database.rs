@@ -7,6 +7,10 @@
 // - Cache de assets procesados (texturas comprimidas, meshes optimizados)
 //
 // Usa sled (embedded KV store) para persistencia ligera sin dependencias externas.
+// Los valores van en bincode (compacto, sin parsing de texto) y el índice
+// completo se carga una sola vez en `open()`: las lecturas nunca tocan disco
+// y las escrituras son write-through. Para cooking, `register_assets` agrupa
+// un lote entero en un solo `apply_batch` + flush.
 // =============================================================================
 
 use std::collections::HashMap;
@@ -41,9 +45,44 @@ pub struct AssetMetadata {
     /// Assets que dependen de este (para invalidar cache)
     pub dependents: Vec<AssetId>,
     /// Metadata específica del tipo (dimensiones, vertex count, etc.)
+    #[serde(with = "extra_codec")]
     pub extra: HashMap<String, serde_json::Value>,
 }
 
+/// `serde_json::Value` necesita `deserialize_any`, que bincode no soporta.
+/// En formatos binarios el mapa `extra` viaja como texto JSON; en formatos
+/// human-readable (export/import JSON) se mantiene como objeto normal.
+mod extra_codec {
+    use std::collections::HashMap;
+
+    use serde::de::Error as DeError;
+    use serde::ser::Error as SerError;
+    use serde::{Deserialize, Deserializer, Serialize, Serializer};
+
+    pub fn serialize<S: Serializer>(
+        map: &HashMap<String, serde_json::Value>,
+        serializer: S,
+    ) -> Result<S::Ok, S::Error> {
+        if serializer.is_human_readable() {
+            map.serialize(serializer)
+        } else {
+            let text = serde_json::to_string(map).map_err(S::Error::custom)?;
+            text.serialize(serializer)
+        }
+    }
+
+    pub fn deserialize<'de, D: Deserializer<'de>>(
+        deserializer: D,
+    ) -> Result<HashMap<String, serde_json::Value>, D::Error> {
+        if deserializer.is_human_readable() {
+            HashMap::deserialize(deserializer)
+        } else {
+            let text = String::deserialize(deserializer)?;
+            serde_json::from_str(&text).map_err(D::Error::custom)
+        }
+    }
+}
+
 /// Tipo de asset para clasificación y routing
 #[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, Serialize, Deserialize)]
 pub enum AssetType {
@@ -92,7 +131,8 @@ impl AssetType {
 /// Database principal para metadata de assets
 pub struct AssetDatabase {
     db: Db,
-    /// Cache en memoria para acceso rápido
+    /// Índice completo en memoria (write-through). Se carga una vez en
+    /// `open()`; todas las lecturas se sirven de aquí.
     memory_cache: HashMap<AssetId, AssetMetadata>,
     /// Path base para resolver rutas relativas
     base_path: PathBuf,
@@ -104,9 +144,11 @@ impl AssetDatabase {
         let db = sled::open(path.as_ref())
             .map_err(|e| ReactorError::asset_load(format!("Failed to open asset DB: {}", e)))?;
 
+        let memory_cache = Self::load_index(&db)?;
+
         Ok(Self {
             db,
-            memory_cache: HashMap::new(),
+            memory_cache,
             base_path: PathBuf::from("assets"),
         })
     }
@@ -125,6 +167,43 @@ impl AssetDatabase {
         })
     }
 
+    /// Cargar el índice completo desde sled (una pasada, en `open()`).
+    /// Entradas legacy en JSON se decodifican igual y se migran a bincode en
+    /// la próxima escritura.
+    fn load_index(db: &Db) -> ReactorResult<HashMap<AssetId, AssetMetadata>> {
+        let mut index = HashMap::new();
+        for item in db.iter() {
+            let (key, value) = item?;
+            let key_str = std::str::from_utf8(&key).unwrap_or("");
+            let Some(id_str) = key_str.strip_prefix("meta:") else {
+                continue;
+            };
+            let Ok(id_val) = u64::from_str_radix(id_str, 16) else {
+                continue;
+            };
+            if let Some(meta) = Self::decode_metadata(&value) {
+                index.insert(AssetId::from(id_val), meta);
+            }
+        }
+        Ok(index)
+    }
+
+    fn decode_metadata(bytes: &[u8]) -> Option<AssetMetadata> {
+        bincode::deserialize(bytes)
+            .ok()
+            .or_else(|| serde_json::from_slice(bytes).ok())
+    }
+
+    fn encode_metadata(meta: &AssetMetadata) -> ReactorResult<Vec<u8>> {
+        bincode::serialize(meta).map_err(|e| {
+            ReactorError::asset_load(format!("Failed to serialize metadata: {}", e))
+        })
+    }
+
+    fn meta_key(id: AssetId) -> String {
+        format!("meta:{:016x}", id.as_u64())
+    }
+
     /// Establecer base path para assets
     pub fn with_base_path<P: AsRef<Path>>(mut self, path: P) -> Self {
         self.base_path = path.as_ref().to_path_buf();
@@ -133,13 +212,10 @@ impl AssetDatabase {
 
     /// Registrar metadata de un asset
     pub fn register_asset(&mut self, id: AssetId, meta: AssetMetadata) -> ReactorResult<()> {
-        // Serializar metadata
-        let serialized = serde_json::to_vec(&meta).map_err(|e| {
-            ReactorError::asset_load(format!("Failed to serialize metadata: {}", e))
-        })?;
+        let serialized = Self::encode_metadata(&meta)?;
 
         // Guardar en sled con key = AssetId como string hex
-        let key = format!("meta:{:016x}", id.as_u64());
+        let key = Self::meta_key(id);
         self.db
             .insert(key.as_bytes(), serialized.as_slice())
             .map_err(|e| ReactorError::asset_load(format!("Failed to write to DB: {}", e)))?;
@@ -147,7 +223,7 @@ impl AssetDatabase {
         // Flush para garantizar persistencia
         self.db.flush()?;
 
-        // Actualizar cache en memoria
+        // Actualizar el índice (write-through)
         self.memory_cache.insert(id, meta.clone());
 
         // Registrar dependencias inversas
@@ -158,30 +234,67 @@ impl AssetDatabase {
         Ok(())
     }
 
-    /// Obtener metadata de un asset por AssetId
-    pub fn get_metadata(&mut self, id: AssetId) -> ReactorResult<Option<AssetMetadata>> {
-        // Check memory cache first
-        if let Some(meta) = self.memory_cache.get(&id) {
-            return Ok(Some(meta.clone()));
+    /// Registrar un lote de assets en una sola transacción de sled.
+    ///
+    /// Para cooking: las dependencias inversas se resuelven en memoria
+    /// (incluidas las que apuntan dentro del mismo lote) y todo se escribe
+    /// con un único `apply_batch` + flush en vez de N inserts + N flushes.
+    pub fn register_assets(
+        &mut self,
+        entries: Vec<(AssetId, AssetMetadata)>,
+    ) -> ReactorResult<usize> {
+        let count = entries.len();
+        let mut touched: Vec<AssetId> = Vec::with_capacity(count);
+
+        // Primero el índice, para que las dependencias inversas dentro del
+        // mismo lote se resuelvan sin tocar disco.
+        for (id, meta) in entries {
+            self.memory_cache.insert(id, meta);
+            touched.push(id);
         }
 
-        // Load from disk
-        let key = format!("meta:{:016x}", id.as_u64());
-        if let Some(data) = self
-            .db
-            .get(key.as_bytes())
-            .map_err(|e| ReactorError::asset_load(format!("Failed to read from DB: {}", e)))?
-        {
-            let meta: AssetMetadata = serde_json::from_slice(&data).map_err(|e| {
-                ReactorError::asset_load(format!("Failed to deserialize metadata: {}", e))
-            })?;
+        for id in touched.clone() {
+            let dependencies = self
+                .memory_cache
+                .get(&id)
+                .map(|m| m.dependencies.clone())
+                .unwrap_or_default();
+            for dep_id in dependencies {
+                if let Some(dep_meta) = self.memory_cache.get_mut(&dep_id) {
+                    if !dep_meta.dependents.contains(&id) {
+                        dep_meta.dependents.push(id);
+                        touched.push(dep_id);
+                    }
+                }
+            }
+        }
 
-            // Cache in memory
-            self.memory_cache.insert(id, meta.clone());
-            Ok(Some(meta))
-        } else {
-            Ok(None)
+        touched.sort_unstable_by_key(|id| id.as_u64());
+        touched.dedup();
+
+        let mut batch = sled::Batch::default();
+        for id in &touched {
+            if let Some(meta) = self.memory_cache.get(id) {
+                batch.insert(
+                    Self::meta_key(*id).into_bytes(),
+                    Self::encode_metadata(meta)?,
+                );
+            }
         }
+        self.db
+            .apply_batch(batch)
+            .map_err(|e| ReactorError::asset_load(format!("Failed to apply batch: {}", e)))?;
+        self.db.flush()?;
+
+        Ok(count)
+    }
+
+    /// Obtener metadata de un asset por AssetId.
+    ///
+    /// El índice está completo desde `open()`, así que esto nunca toca disco
+    /// ni deserializa.
+    pub fn get_metadata(&mut self, id: AssetId) -> ReactorResult<Option<AssetMetadata>> {
+        Ok(self.memory_cache.get(&id).cloned())
     }
 
     /// Obtener metadata por path de archivo
@@ -264,7 +377,7 @@ impl AssetDatabase {
             self.memory_cache.remove(&id);
 
             // Remover de DB
-            let key = format!("meta:{:016x}", id.as_u64());
+            let key = Self::meta_key(id);
             self.db.remove(key.as_bytes())?;
 
             invalidated.push(id);
@@ -273,30 +386,13 @@ impl AssetDatabase {
         Ok(invalidated)
     }
 
-    /// Listar todos los assets registrados
+    /// Listar todos los assets registrados (desde el índice, sin tocar disco)
     pub fn list_assets(&self) -> ReactorResult<Vec<(AssetId, AssetMetadata)>> {
-        let mut assets = Vec::new();
-
-        for item in self.db.iter() {
-            let (key, value) = item?;
-            let key_str = std::str::from_utf8(&key).unwrap_or("");
-
-            if key_str.starts_with("meta:") {
-                if let Ok(id_str) = key_str
-                    .strip_prefix("meta:")
-                    .ok_or_else(|| ReactorError::asset_load("Invalid metadata key format"))
-                {
-                    if let Ok(id_val) = u64::from_str_radix(id_str, 16) {
-                        let id = AssetId::from(id_val);
-                        if let Ok(meta) = serde_json::from_slice::<AssetMetadata>(&value) {
-                            assets.push((id, meta));
-                        }
-                    }
-                }
-            }
-        }
-
-        Ok(assets)
+        Ok(self
+            .memory_cache
+            .iter()
+            .map(|(id, meta)| (*id, meta.clone()))
+            .collect())
     }
 
     /// Obtener estadísticas de la database
@@ -316,15 +412,7 @@ impl AssetDatabase {
 
     /// Exportar metadata a JSON (para debugging o backup)
     pub fn export_json(&self) -> ReactorResult<String> {
-        let mut assets = Vec::new();
-
-        for item in self.db.iter() {
-            let (_, value) = item?;
-            if let Ok(meta) = serde_json::from_slice::<AssetMetadata>(&value) {
-                assets.push(meta);
-            }
-        }
-
+        let assets: Vec<&AssetMetadata> = self.memory_cache.values().collect();
         serde_json::to_string_pretty(&assets)
             .map_err(|e| ReactorError::asset_load(format!("Failed to serialize: {}", e)))
     }
@@ -452,4 +540,63 @@ mod tests {
 
         Ok(())
     }
+
+    fn make_meta(path: &str) -> AssetMetadata {
+        AssetMetadata {
+            source_path: path.into(),
+            content_hash: 1,
+            last_modified: 0,
+            file_size: 0,
+            asset_type: AssetType::from_extension(
+                Path::new(path).extension().and_then(|e| e.to_str()).unwrap_or(""),
+            ),
+            source_format: String::new(),
+            runtime_format: None,
+            dependencies: Vec::new(),
+            dependents: Vec::new(),
+            extra: HashMap::new(),
+        }
+    }
+
+    #[test]
+    fn test_batch_register_resolves_in_batch_dependents() -> ReactorResult<()> {
+        let mut db = AssetDatabase::in_memory()?;
+
+        let tex_id = AssetId::from_path("albedo.png");
+        let mat_id = AssetId::from_path("wall.mat");
+        let mut mat = make_meta("wall.mat");
+        mat.dependencies.push(tex_id);
+
+        let count = db.register_assets(vec![(tex_id, make_meta("albedo.png")), (mat_id, mat)])?;
+        assert_eq!(count, 2);
+
+        // La dependencia inversa se resolvió dentro del mismo lote
+        let tex = db.get_metadata(tex_id)?.unwrap();
+        assert_eq!(tex.dependents, vec![mat_id]);
+        assert_eq!(db.list_assets()?.len(), 2);
+
+        Ok(())
+    }
+
+    #[test]
+    fn test_index_survives_reopen() -> ReactorResult<()> {
+        let path = std::env::temp_dir().join(format!("reactor_asset_db_{}", std::process::id()));
+        let _ = std::fs::remove_dir_all(&path);
+
+        let id = AssetId::from_path("scene.gltf");
+        {
+            let mut db = AssetDatabase::open(&path)?;
+            let meta = make_meta("scene.gltf").with_extra("vertex_count", 4096);
+            db.register_asset(id, meta)?;
+        }
+
+        // Reabrir: el índice se carga completo desde bincode, extra incluido
+        let mut db = AssetDatabase::open(&path)?;
+        let meta = db.get_metadata(id)?.unwrap();
+        assert_eq!(meta.extra.get("vertex_count"), Some(&serde_json::json!(4096)));
+
+        drop(db);
+        let _ = std::fs::remove_dir_all(&path);
+        Ok(())
+    }
 }
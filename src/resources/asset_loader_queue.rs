@@ -341,6 +341,45 @@ impl AssetLoaderQueue {
         })
     }
 
+    /// Enqueue carga de una mesh cocida (RTMH). El camino caliente en
+    /// runtime: un read + dos pod casts, sin parsear glTF. Para el mismo
+    /// formato dentro de un pack usar `enqueue_from_pack` con
+    /// `CookedMesh::from_bytes`.
+    pub fn enqueue_cooked_mesh(
+        &self,
+        id: AssetId,
+        path: PathBuf,
+        priority: LoadPriority,
+    ) -> oneshot::Receiver<ReactorResult<Handle<crate::resources::cooked_mesh::CookedMesh>>> {
+        let load_path = path.clone();
+        self.enqueue(id, path, priority, move || {
+            crate::resources::cooked_mesh::CookedMesh::read_from(&load_path)
+        })
+    }
+
+    /// Enqueue una carga desde un asset pack memory-mapped. El parser recibe
+    /// el payload como slice directo del mapping (cero copias intermedias);
+    /// no hay open/read por asset, solo un probe en la tabla de offsets.
+    pub fn enqueue_from_pack<T, F>(
+        &self,
+        pack: Arc<crate::resources::asset_pack::AssetPack>,
+        id: AssetId,
+        priority: LoadPriority,
+        parse: F,
+    ) -> oneshot::Receiver<ReactorResult<Handle<T>>>
+    where
+        F: FnOnce(&[u8]) -> ReactorResult<T> + Send + 'static,
+        T: Send + Sync + 'static,
+    {
+        let path = PathBuf::from(format!("pack:{}", id));
+        self.enqueue(id, path, priority, move || {
+            let bytes = pack.bytes(id).ok_or_else(|| {
+                ReactorError::asset_load(format!("Asset {} not found in pack", id))
+            })?;
+            parse(bytes)
+        })
+    }
+
     /// Cancelar una carga pendiente por AssetId
     pub fn cancel(&self, id: AssetId) -> bool {
         let mut queue = self.queue.lock().unwrap();
@@ -0,0 +1,242 @@
+// =============================================================================
+// REACTOR Asset Pack — single-file cooked asset archive, memory-mapped
+// =============================================================================
+// Replaces thousands of loose cooked files with one archive the loader maps
+// into the address space. Blobs are 4K-aligned so page-cache reads and GPU
+// staging line up, and the offset table is keyed by the asset's XXH3-based
+// AssetId, so lookup is a single HashMap probe and `bytes()` hands out a
+// slice straight into the mapping — zero intermediate copies on the way to
+// a staging buffer.
+//
+// Layout:
+//   [header: 32 bytes]  magic "RPAK", version, entry count, table offset
+//   [blobs]             each aligned to 4096 bytes
+//   [table]             entry_count × { key: u64, offset: u64, size: u64 }
+// =============================================================================
+
+use std::collections::HashMap;
+use std::fs;
+use std::io::{Seek, SeekFrom, Write};
+use std::path::Path;
+
+use crate::core::error::{ReactorError, ReactorResult};
+use crate::resources::asset_id::AssetId;
+
+const PACK_MAGIC: &[u8; 4] = b"RPAK";
+const PACK_VERSION: u32 = 1;
+const HEADER_SIZE: u64 = 32;
+const ENTRY_SIZE: usize = 24;
+/// Blob alignment. Matches the page size so a mapped payload can be handed
+/// to staging uploads without straddling pages unnecessarily.
+const BLOB_ALIGN: u64 = 4096;
+
+struct PackEntry {
+    key: u64,
+    offset: u64,
+    size: u64,
+}
+
+// =============================================================================
+// Writer (cooker side)
+// =============================================================================
+
+/// Streams cooked blobs into a pack file. Call [`AssetPackWriter::finish`]
+/// to emit the offset table and finalize the header.
+pub struct AssetPackWriter {
+    file: fs::File,
+    entries: Vec<PackEntry>,
+    cursor: u64,
+}
+
+impl AssetPackWriter {
+    pub fn create<P: AsRef<Path>>(path: P) -> ReactorResult<Self> {
+        let mut file = fs::File::create(path.as_ref())?;
+        // Header placeholder; rewritten by finish() once counts are known.
+        file.write_all(&[0u8; HEADER_SIZE as usize])?;
+        Ok(Self { file, entries: Vec::new(), cursor: HEADER_SIZE })
+    }
+
+    /// Append one cooked blob, 4K-aligned. Duplicate keys keep the first blob.
+    pub fn add(&mut self, id: AssetId, data: &[u8]) -> ReactorResult<()> {
+        let key = id.as_u64();
+        if self.entries.iter().any(|e| e.key == key) {
+            return Ok(());
+        }
+
+        let aligned = (self.cursor + BLOB_ALIGN - 1) & !(BLOB_ALIGN - 1);
+        let padding = (aligned - self.cursor) as usize;
+        if padding > 0 {
+            self.file.write_all(&vec![0u8; padding])?;
+        }
+        self.file.write_all(data)?;
+
+        self.entries.push(PackEntry { key, offset: aligned, size: data.len() as u64 });
+        self.cursor = aligned + data.len() as u64;
+        Ok(())
+    }
+
+    pub fn entry_count(&self) -> usize {
+        self.entries.len()
+    }
+
+    /// Write the offset table and the real header, then flush.
+    pub fn finish(mut self) -> ReactorResult<()> {
+        let table_offset = self.cursor;
+        for entry in &self.entries {
+            self.file.write_all(&entry.key.to_le_bytes())?;
+            self.file.write_all(&entry.offset.to_le_bytes())?;
+            self.file.write_all(&entry.size.to_le_bytes())?;
+        }
+
+        self.file.seek(SeekFrom::Start(0))?;
+        self.file.write_all(PACK_MAGIC)?;
+        self.file.write_all(&PACK_VERSION.to_le_bytes())?;
+        self.file.write_all(&(self.entries.len() as u32).to_le_bytes())?;
+        self.file.write_all(&0u32.to_le_bytes())?; // reserved
+        self.file.write_all(&table_offset.to_le_bytes())?;
+        self.file.flush()?;
+        Ok(())
+    }
+}
+
+// =============================================================================
+// Reader (loader side)
+// =============================================================================
+
+/// Memory-mapped asset pack. Opening is one `open()` + one `mmap()` no matter
+/// how many assets the pack holds; `bytes()` is a HashMap probe returning a
+/// slice into the mapping.
+pub struct AssetPack {
+    map: memmap2::Mmap,
+    index: HashMap<u64, (u64, u64)>,
+}
+
+impl AssetPack {
+    pub fn open<P: AsRef<Path>>(path: P) -> ReactorResult<Self> {
+        let file = fs::File::open(path.as_ref())?;
+        // Safety: the pack is cooked output; we treat concurrent modification
+        // as a pipeline bug, same as the loose-file loaders did.
+        let map = unsafe { memmap2::Mmap::map(&file)? };
+
+        if map.len() < HEADER_SIZE as usize || &map[0..4] != PACK_MAGIC {
+            return Err(ReactorError::asset_load(format!(
+                "'{}' is not an asset pack",
+                path.as_ref().display()
+            )));
+        }
+        let version = u32::from_le_bytes(map[4..8].try_into().unwrap());
+        if version != PACK_VERSION {
+            return Err(ReactorError::asset_load(format!(
+                "Unsupported asset pack version {}",
+                version
+            )));
+        }
+
+        let entry_count = u32::from_le_bytes(map[8..12].try_into().unwrap()) as usize;
+        let table_offset = u64::from_le_bytes(map[16..24].try_into().unwrap()) as usize;
+        let table_end = table_offset + entry_count * ENTRY_SIZE;
+        if table_end > map.len() {
+            return Err(ReactorError::asset_load("Asset pack offset table out of bounds"));
+        }
+
+        let mut index = HashMap::with_capacity(entry_count);
+        for i in 0..entry_count {
+            let base = table_offset + i * ENTRY_SIZE;
+            let key = u64::from_le_bytes(map[base..base + 8].try_into().unwrap());
+            let offset = u64::from_le_bytes(map[base + 8..base + 16].try_into().unwrap());
+            let size = u64::from_le_bytes(map[base + 16..base + 24].try_into().unwrap());
+            if offset + size > map.len() as u64 {
+                return Err(ReactorError::asset_load("Asset pack blob out of bounds"));
+            }
+            index.insert(key, (offset, size));
+        }
+
+        Ok(Self { map, index })
+    }
+
+    /// Blob payload for an asset, straight out of the mapping. Hand this to
+    /// the parsers or directly to a staging-buffer write — no copy happens
+    /// until the data is actually consumed.
+    pub fn bytes(&self, id: AssetId) -> Option<&[u8]> {
+        self.index
+            .get(&id.as_u64())
+            .map(|&(offset, size)| &self.map[offset as usize..(offset + size) as usize])
+    }
+
+    pub fn contains(&self, id: AssetId) -> bool {
+        self.index.contains_key(&id.as_u64())
+    }
+
+    pub fn len(&self) -> usize {
+        self.index.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.index.is_empty()
+    }
+
+    /// All asset ids in the pack (unordered).
+    pub fn ids(&self) -> impl Iterator<Item = AssetId> + '_ {
+        self.index.keys().map(|&k| AssetId::from(k))
+    }
+}
+
+// =============================================================================
+// Tests
+// =============================================================================
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn temp_pack_path(name: &str) -> std::path::PathBuf {
+        std::env::temp_dir().join(format!("reactor_pack_{}_{}.rpak", name, std::process::id()))
+    }
+
+    #[test]
+    fn test_pack_roundtrip() {
+        let path = temp_pack_path("roundtrip");
+        let a = AssetId::from_path("textures/brick.png");
+        let b = AssetId::from_path("models/crate.glb");
+
+        let mut writer = AssetPackWriter::create(&path).unwrap();
+        writer.add(a, b"aaaa-payload").unwrap();
+        writer.add(b, &vec![7u8; 10000]).unwrap();
+        writer.finish().unwrap();
+
+        let pack = AssetPack::open(&path).unwrap();
+        assert_eq!(pack.len(), 2);
+        assert_eq!(pack.bytes(a).unwrap(), b"aaaa-payload");
+        assert_eq!(pack.bytes(b).unwrap().len(), 10000);
+        assert!(pack.bytes(AssetId::from_path("missing.png")).is_none());
+
+        fs::remove_file(&path).ok();
+    }
+
+    #[test]
+    fn test_blobs_are_page_aligned() {
+        let path = temp_pack_path("aligned");
+        let a = AssetId::from_path("a.bin");
+        let b = AssetId::from_path("b.bin");
+
+        let mut writer = AssetPackWriter::create(&path).unwrap();
+        writer.add(a, &[1u8; 100]).unwrap();
+        writer.add(b, &[2u8; 100]).unwrap();
+        writer.finish().unwrap();
+
+        let pack = AssetPack::open(&path).unwrap();
+        for (_, &(offset, _)) in pack.index.iter() {
+            assert_eq!(offset % BLOB_ALIGN, 0);
+        }
+
+        fs::remove_file(&path).ok();
+    }
+
+    #[test]
+    fn test_rejects_garbage() {
+        let path = temp_pack_path("garbage");
+        fs::write(&path, b"definitely not a pack file").unwrap();
+        assert!(AssetPack::open(&path).is_err());
+        fs::remove_file(&path).ok();
+    }
+}
@@ -0,0 +1,160 @@
+// =============================================================================
+// REACTOR Cooked Mesh — RTMH runtime format
+// =============================================================================
+// Vertex/index blobs already in the final GPU layout (`Vertex` + u32 indices),
+// written by the AssetCooker and read back with a header check plus two pod
+// casts. Runtime loads are a file read + upload: no glTF parsing at all.
+//
+// Layout (little-endian):
+//   "RTMH" | version: u32 | vertex_count: u32 | index_count: u32
+//   | vertices: [Vertex; vertex_count] | indices: [u32; index_count]
+// =============================================================================
+
+use std::fs;
+use std::io::Write;
+use std::path::Path;
+
+use crate::core::error::{ErrorCode, ReactorError, ReactorResult};
+use crate::resources::vertex::Vertex;
+
+pub const COOKED_MESH_MAGIC: &[u8; 4] = b"RTMH";
+pub const COOKED_MESH_VERSION: u32 = 1;
+
+/// Mesh cocida lista para subir: los blobs ya están en el layout de GPU.
+#[derive(Clone, Debug)]
+pub struct CookedMesh {
+    pub vertices: Vec<Vertex>,
+    pub indices: Vec<u32>,
+}
+
+impl CookedMesh {
+    /// Escribe el formato RTMH (usado por el AssetCooker).
+    pub fn write_to(path: &Path, vertices: &[Vertex], indices: &[u32]) -> ReactorResult<()> {
+        let mut file = fs::File::create(path).map_err(|e| {
+            ReactorError::with_source(
+                ErrorCode::IoError,
+                format!("Failed to create cooked mesh: {}", path.display()),
+                e,
+            )
+        })?;
+
+        let write = |file: &mut fs::File, bytes: &[u8]| {
+            file.write_all(bytes).map_err(|e| {
+                ReactorError::with_source(
+                    ErrorCode::IoError,
+                    format!("Failed to write cooked mesh: {}", path.display()),
+                    e,
+                )
+            })
+        };
+
+        write(&mut file, COOKED_MESH_MAGIC)?;
+        write(&mut file, &COOKED_MESH_VERSION.to_le_bytes())?;
+        write(&mut file, &(vertices.len() as u32).to_le_bytes())?;
+        write(&mut file, &(indices.len() as u32).to_le_bytes())?;
+        write(&mut file, bytemuck::cast_slice::<Vertex, u8>(vertices))?;
+        write(&mut file, bytemuck::cast_slice::<u32, u8>(indices))?;
+        Ok(())
+    }
+
+    /// Lee un RTMH desde disco.
+    pub fn read_from(path: &Path) -> ReactorResult<Self> {
+        let bytes = fs::read(path).map_err(|e| {
+            ReactorError::with_source(
+                ErrorCode::IoError,
+                format!("Failed to read cooked mesh: {}", path.display()),
+                e,
+            )
+        })?;
+        Self::from_bytes(&bytes)
+    }
+
+    /// Parsea un RTMH desde memoria (slice directo de un asset pack).
+    ///
+    /// `pod_collect_to_vec` copia porque el slice llega sin alineación
+    /// garantizada; sigue siendo un memcpy plano por blob.
+    pub fn from_bytes(bytes: &[u8]) -> ReactorResult<Self> {
+        const HEADER: usize = 16;
+        if bytes.len() < HEADER || &bytes[0..4] != COOKED_MESH_MAGIC {
+            return Err(ReactorError::new(
+                ErrorCode::InvalidFormat,
+                "Not a cooked mesh (RTMH magic missing)",
+            ));
+        }
+        let version = u32::from_le_bytes(bytes[4..8].try_into().unwrap());
+        if version != COOKED_MESH_VERSION {
+            return Err(ReactorError::new(
+                ErrorCode::InvalidFormat,
+                format!("Unsupported cooked mesh version: {}", version),
+            ));
+        }
+        let vertex_count = u32::from_le_bytes(bytes[8..12].try_into().unwrap()) as usize;
+        let index_count = u32::from_le_bytes(bytes[12..16].try_into().unwrap()) as usize;
+
+        let vertex_bytes = vertex_count * std::mem::size_of::<Vertex>();
+        let index_bytes = index_count * std::mem::size_of::<u32>();
+        if bytes.len() < HEADER + vertex_bytes + index_bytes {
+            return Err(ReactorError::new(
+                ErrorCode::InvalidFormat,
+                "Cooked mesh truncated",
+            ));
+        }
+
+        let vertices: Vec<Vertex> =
+            bytemuck::pod_collect_to_vec(&bytes[HEADER..HEADER + vertex_bytes]);
+        let indices: Vec<u32> = bytemuck::pod_collect_to_vec(
+            &bytes[HEADER + vertex_bytes..HEADER + vertex_bytes + index_bytes],
+        );
+
+        Ok(Self { vertices, indices })
+    }
+}
+
+// =============================================================================
+// Tests
+// =============================================================================
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use glam::{Vec2, Vec3};
+
+    fn sample_mesh() -> (Vec<Vertex>, Vec<u32>) {
+        let vertices = vec![
+            Vertex::new(Vec3::new(0.0, 0.0, 0.0), Vec3::ONE, Vec2::ZERO),
+            Vertex::new(Vec3::new(1.0, 0.0, 0.0), Vec3::ONE, Vec2::X),
+            Vertex::new(Vec3::new(0.0, 1.0, 0.0), Vec3::ONE, Vec2::Y),
+        ];
+        (vertices, vec![0, 1, 2])
+    }
+
+    #[test]
+    fn test_cooked_mesh_roundtrip() -> ReactorResult<()> {
+        let path = std::env::temp_dir().join(format!("reactor_rtmh_{}.mesh", std::process::id()));
+        let (vertices, indices) = sample_mesh();
+
+        CookedMesh::write_to(&path, &vertices, &indices)?;
+        let cooked = CookedMesh::read_from(&path)?;
+        let _ = std::fs::remove_file(&path);
+
+        assert_eq!(cooked.vertices.len(), vertices.len());
+        assert_eq!(cooked.indices, indices);
+        assert_eq!(
+            bytemuck::cast_slice::<Vertex, u8>(&cooked.vertices),
+            bytemuck::cast_slice::<Vertex, u8>(&vertices),
+        );
+        Ok(())
+    }
+
+    #[test]
+    fn test_from_bytes_rejects_garbage() {
+        assert!(CookedMesh::from_bytes(b"not a mesh").is_err());
+        // Magic correcto pero truncado
+        let mut bytes = Vec::new();
+        bytes.extend_from_slice(COOKED_MESH_MAGIC);
+        bytes.extend_from_slice(&COOKED_MESH_VERSION.to_le_bytes());
+        bytes.extend_from_slice(&100u32.to_le_bytes());
+        bytes.extend_from_slice(&100u32.to_le_bytes());
+        assert!(CookedMesh::from_bytes(&bytes).is_err());
+    }
+}
@@ -91,45 +91,35 @@ pub(super) fn extract_mesh(
     mesh: &gltf::Mesh,
     buffers: &[GltfBufferData],
 ) -> ReactorResult<GltfMeshData> {
+    // Decode primitives in parallel (local 0-based indices), then merge
+    // serially applying base_vertex offsets. parallel_reduce preserves
+    // primitive order, so the merged buffers match the old serial output.
+    let primitives: Vec<gltf::Primitive> = mesh.primitives().collect();
+
+    let decoded = crate::core::jobs::parallel_reduce(
+        &primitives,
+        Vec::new,
+        |mut acc: Vec<ReactorResult<DecodedPrimitive>>, primitive| {
+            acc.push(decode_primitive(primitive, buffers));
+            acc
+        },
+        |mut a, mut b| {
+            a.append(&mut b);
+            a
+        },
+    );
+
     let mut vertices = Vec::new();
     let mut indices = Vec::new();
     let mut material_index = None;
 
-    for primitive in mesh.primitives() {
-        let reader = primitive.reader(|buffer| Some(&buffers[buffer.index()]));
-
-        let positions: Vec<[f32; 3]> = reader
-            .read_positions()
-            .ok_or_else(|| ReactorError::asset_load("Mesh missing positions"))?
-            .collect();
-
-        let normals: Vec<[f32; 3]> = reader
-            .read_normals()
-            .map(|n| n.collect())
-            .unwrap_or_else(|| vec![[0.0, 0.0, 1.0]; positions.len()]);
-
-        let uvs: Vec<[f32; 2]> = reader
-            .read_tex_coords(0)
-            .map(|uv| uv.into_f32().collect())
-            .unwrap_or_else(|| vec![[0.0, 0.0]; positions.len()]);
-
+    for result in decoded {
+        let decoded = result?;
         let base_vertex = vertices.len() as u32;
-        for i in 0..positions.len() {
-            vertices.push(Vertex::with_normal(
-                Vec3::from(positions[i]),
-                Vec3::from(normals[i]),
-                Vec2::from(uvs[i]),
-            ));
-        }
-
-        if let Some(idx_reader) = reader.read_indices() {
-            indices.extend(idx_reader.into_u32().map(|i| i + base_vertex));
-        } else {
-            indices.extend(base_vertex..(base_vertex + positions.len() as u32));
-        }
-
+        vertices.extend(decoded.vertices);
+        indices.extend(decoded.indices.into_iter().map(|i| i + base_vertex));
         if material_index.is_none() {
-            material_index = primitive.material().index();
+            material_index = decoded.material_index;
         }
     }
 
@@ -145,6 +135,55 @@ pub(super) fn extract_mesh(
     })
 }
 
+struct DecodedPrimitive {
+    vertices: Vec<Vertex>,
+    indices: Vec<u32>,
+    material_index: Option<usize>,
+}
+
+fn decode_primitive(
+    primitive: &gltf::Primitive,
+    buffers: &[GltfBufferData],
+) -> ReactorResult<DecodedPrimitive> {
+    let reader = primitive.reader(|buffer| Some(&buffers[buffer.index()]));
+
+    let positions: Vec<[f32; 3]> = reader
+        .read_positions()
+        .ok_or_else(|| ReactorError::asset_load("Mesh missing positions"))?
+        .collect();
+
+    let normals: Vec<[f32; 3]> = reader
+        .read_normals()
+        .map(|n| n.collect())
+        .unwrap_or_else(|| vec![[0.0, 0.0, 1.0]; positions.len()]);
+
+    let uvs: Vec<[f32; 2]> = reader
+        .read_tex_coords(0)
+        .map(|uv| uv.into_f32().collect())
+        .unwrap_or_else(|| vec![[0.0, 0.0]; positions.len()]);
+
+    let mut vertices = Vec::with_capacity(positions.len());
+    for i in 0..positions.len() {
+        vertices.push(Vertex::with_normal(
+            Vec3::from(positions[i]),
+            Vec3::from(normals[i]),
+            Vec2::from(uvs[i]),
+        ));
+    }
+
+    let indices: Vec<u32> = if let Some(idx_reader) = reader.read_indices() {
+        idx_reader.into_u32().collect()
+    } else {
+        (0..positions.len() as u32).collect()
+    };
+
+    Ok(DecodedPrimitive {
+        vertices,
+        indices,
+        material_index: primitive.material().index(),
+    })
+}
+
 pub(super) fn build_node_hierarchy(gltf: &gltf::Document) -> ReactorResult<GltfNode> {
     let scene = gltf
         .default_scene()
@@ -18,6 +18,8 @@ pub mod asset_hot_reload;
 pub mod asset_id;
 pub mod asset_loader_queue;
 pub mod asset_manager;
+pub mod asset_pack;
+pub mod cooked_mesh;
 pub mod font;
 pub mod gltf_loader;
 pub mod handle;
@@ -34,10 +36,12 @@ pub use asset_id::{AssetId, AssetPath};
 pub use handle::{AssetRef, Handle, WeakHandle};
 
 // Fase 3: GltfLoader, AssetDatabase, HotReload y LoaderQueue
-pub use asset_cooker::AssetCooker;
+pub use asset_cooker::{AssetCooker, CookBudgets, CookStats};
 pub use asset_database::{AssetDatabase, AssetDbStats, AssetMetadata, AssetType};
 pub use asset_hot_reload::{AssetHotReloadManager, HotReloadConfig, HotReloadStats};
 pub use asset_loader_queue::{AssetLoaderQueue, LoadPriority, LoaderQueueConfig, LoaderStats};
+pub use asset_pack::{AssetPack, AssetPackWriter};
+pub use cooked_mesh::CookedMesh;
 pub use font::FontAsset;
 pub use gltf_loader::{
     GltfCacheStats, GltfLoader, GltfMaterialData, GltfMeshData, GltfModel, GltfNode,
@@ -53,6 +57,8 @@ pub use mesh::Mesh;
 pub use model::{GltfData, Model, ModelBatch, ObjData};
 pub use pbr_material::{IBLEnvironment, IBLUniformData, PBRMaterial, PBRTextures, PBRUniformData};
 pub use primitives::Primitives;
-pub use texture::Texture;
+pub use texture::{
+    ResidencyCommand, ResidencyStats, Texture, TextureResidencyDesc, TextureResidencyManager,
+};
 pub use vertex::{InstanceData, Vertex, VertexPBR};
 
@@ -10,8 +10,13 @@ use gpu_allocator::MemoryLocation;
 use std::path::Path;
 use std::sync::{Arc, Mutex};
 
+pub mod residency;
 mod upload;
 
+pub use residency::{
+    ResidencyCommand, ResidencyStats, TextureResidencyDesc, TextureResidencyManager,
+};
+
 pub struct Texture {
     pub image: Image,
     pub sampler: Sampler,
@@ -112,6 +117,98 @@ impl Texture {
         Self::from_rgba(ctx, allocator, data, width, height, false)
     }
 
+    /// Carga un KTX2 omitiendo los primeros `base_mip` niveles: la imagen
+    /// resultante contiene los mips [base_mip..] con la cadena completa
+    /// subida en un solo submit.
+    ///
+    /// Es el camino de ejecución de los `ResidencyCommand` del
+    /// `TextureResidencyManager`: stream in/out = recrear la textura con
+    /// otro base mip y swapear el descriptor.
+    pub fn from_ktx2_with_base_mip(
+        ctx: &VulkanContext,
+        allocator: Arc<Mutex<Allocator>>,
+        bytes: &[u8],
+        base_mip: u32,
+    ) -> ReactorResult<Self> {
+        let reader = ktx2::Reader::new(bytes)
+            .map_err(|e| ReactorError::internal(format!("Failed to parse KTX2: {:?}", e)))?;
+
+        let header = reader.header();
+        let total_levels = header.level_count.max(1);
+        let base_mip = base_mip.min(total_levels - 1);
+        let width = (header.pixel_width >> base_mip).max(1);
+        let height = (header.pixel_height >> base_mip).max(1);
+
+        let levels: Vec<&[u8]> = reader.levels().skip(base_mip as usize).collect();
+        if levels.is_empty() {
+            return Err(ReactorError::internal("KTX2 has no mipmap levels"));
+        }
+        let mip_levels = levels.len() as u32;
+
+        let image = Image::new_texture_with_format(
+            ctx,
+            allocator.clone(),
+            width,
+            height,
+            vk::Format::R8G8B8A8_SRGB,
+            mip_levels,
+        )?;
+
+        // Empaquetar todos los niveles en un solo staging, una región por mip.
+        let total_size: u64 = levels.iter().map(|l| l.len() as u64).sum();
+        let staging = Buffer::new(
+            ctx,
+            allocator.clone(),
+            total_size,
+            vk::BufferUsageFlags::TRANSFER_SRC,
+            MemoryLocation::CpuToGpu,
+        )?;
+
+        let mut regions = Vec::with_capacity(levels.len());
+        let mut offset = 0u64;
+        if let Some(ptr) = staging.map::<u8>() {
+            for (i, level) in levels.iter().enumerate() {
+                unsafe {
+                    ptr.add(offset as usize)
+                        .copy_from_nonoverlapping(level.as_ptr(), level.len());
+                }
+                regions.push(
+                    vk::BufferImageCopy::default()
+                        .buffer_offset(offset)
+                        .buffer_row_length(0)
+                        .buffer_image_height(0)
+                        .image_subresource(
+                            vk::ImageSubresourceLayers::default()
+                                .aspect_mask(vk::ImageAspectFlags::COLOR)
+                                .mip_level(i as u32)
+                                .base_array_layer(0)
+                                .layer_count(1),
+                        )
+                        .image_offset(vk::Offset3D { x: 0, y: 0, z: 0 })
+                        .image_extent(vk::Extent3D {
+                            width: (width >> i).max(1),
+                            height: (height >> i).max(1),
+                            depth: 1,
+                        }),
+                );
+                offset += level.len() as u64;
+            }
+        }
+
+        upload::copy_buffer_to_image_levels(ctx, staging.handle, image.handle, &regions, mip_levels)?;
+        upload::transition_to_shader_read(ctx, image.handle, mip_levels)?;
+
+        let sampler = Sampler::linear(ctx)?;
+
+        Ok(Self {
+            image,
+            sampler,
+            width,
+            height,
+            device: ctx.device.clone(),
+        })
+    }
+
     pub fn solid_color(
         ctx: &VulkanContext,
         allocator: Arc<Mutex<Allocator>>,
@@ -0,0 +1,350 @@
+// =============================================================================
+// TextureResidencyManager — Streaming de mips bajo presupuesto de VRAM
+// =============================================================================
+// Política pura de CPU: decide qué mips de cada textura deben estar residentes
+// según importancia (alimentada desde `ImportanceMap`), último uso y el
+// presupuesto consultado por `GpuMemoryBudget`. No toca Vulkan — emite
+// `ResidencyCommand`s que el loader ejecuta recreando la textura con
+// `Texture::from_ktx2_with_base_mip` (mips [base..] residentes).
+//
+// Orden de desalojo: primero los mips altos de texturas lejanas (importancia
+// baja) y frías (último uso viejo). El mip tail (`min_resident_mips` niveles)
+// nunca se desaloja: una textura degradada sigue siendo sampleable.
+// =============================================================================
+
+use std::collections::HashMap;
+
+use crate::core::memory_budget::GpuMemoryBudget;
+use crate::resources::asset_id::AssetId;
+
+/// Fracción del budget de VRAM que pueden ocupar las texturas streameadas.
+/// El resto queda para render targets, buffers y el margen del driver.
+const DEFAULT_BUDGET_FRACTION: f32 = 0.6;
+/// Niveles del mip tail siempre residentes (con 4, una textura 4K degrada
+/// hasta ~512×512 antes de tocar fondo).
+const DEFAULT_MIN_RESIDENT_MIPS: u32 = 4;
+
+/// Descripción inmutable de una textura registrada.
+#[derive(Clone, Copy, Debug)]
+pub struct TextureResidencyDesc {
+    pub width: u32,
+    pub height: u32,
+    pub mip_levels: u32,
+    /// Bytes por pixel del formato runtime (4 para RGBA8; para formatos por
+    /// bloque, el promedio equivalente).
+    pub bytes_per_pixel: u32,
+}
+
+impl TextureResidencyDesc {
+    /// Bytes de los mips [base_mip..mip_levels).
+    pub fn bytes_from_mip(&self, base_mip: u32) -> u64 {
+        let mut total = 0u64;
+        for level in base_mip..self.mip_levels {
+            let w = (self.width >> level).max(1) as u64;
+            let h = (self.height >> level).max(1) as u64;
+            total += w * h * self.bytes_per_pixel as u64;
+        }
+        total
+    }
+
+    /// Base mip mínimo residente (el inicio del mip tail protegido).
+    fn floor_mip(&self, min_resident_mips: u32) -> u32 {
+        self.mip_levels.saturating_sub(min_resident_mips)
+    }
+}
+
+/// Estado de residencia de una textura.
+#[derive(Clone, Copy, Debug)]
+struct ResidencyState {
+    desc: TextureResidencyDesc,
+    /// Primer mip actualmente residente (0 = resolución completa).
+    resident_base_mip: u32,
+    /// Primer mip que la política quiere residente.
+    target_base_mip: u32,
+    importance: f32,
+    last_used_frame: u64,
+}
+
+/// Comando para el loader: recrear la textura con mips [base_mip..].
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum ResidencyCommand {
+    /// Subir mips: la textura gana resolución (stream in del KTX2).
+    StreamIn { id: AssetId, base_mip: u32 },
+    /// Soltar mips altos: la textura pierde resolución (libera VRAM).
+    Evict { id: AssetId, base_mip: u32 },
+}
+
+/// Estadísticas de la última pasada de `update()`.
+#[derive(Clone, Copy, Debug, Default)]
+pub struct ResidencyStats {
+    pub registered: usize,
+    pub resident_bytes: u64,
+    pub budget_bytes: u64,
+    pub streamed_in: usize,
+    pub evicted: usize,
+}
+
+pub struct TextureResidencyManager {
+    textures: HashMap<AssetId, ResidencyState>,
+    budget_fraction: f32,
+    min_resident_mips: u32,
+    stats: ResidencyStats,
+}
+
+impl TextureResidencyManager {
+    pub fn new() -> Self {
+        Self {
+            textures: HashMap::new(),
+            budget_fraction: DEFAULT_BUDGET_FRACTION,
+            min_resident_mips: DEFAULT_MIN_RESIDENT_MIPS,
+            stats: ResidencyStats::default(),
+        }
+    }
+
+    pub fn with_budget_fraction(mut self, fraction: f32) -> Self {
+        self.budget_fraction = fraction.clamp(0.05, 1.0);
+        self
+    }
+
+    /// Registra una textura recién subida (totalmente residente).
+    pub fn register(&mut self, id: AssetId, desc: TextureResidencyDesc, frame: u64) {
+        self.textures.insert(
+            id,
+            ResidencyState {
+                desc,
+                resident_base_mip: 0,
+                target_base_mip: 0,
+                importance: 1.0,
+                last_used_frame: frame,
+            },
+        );
+    }
+
+    pub fn unregister(&mut self, id: AssetId) {
+        self.textures.remove(&id);
+    }
+
+    /// Marca la textura como usada este frame (llamar al encolar draws).
+    pub fn touch(&mut self, id: AssetId, frame: u64) {
+        if let Some(state) = self.textures.get_mut(&id) {
+            state.last_used_frame = frame;
+        }
+    }
+
+    /// Alimenta la importancia combinada del tile donde vive el objeto que
+    /// usa la textura (`ImportanceTileData::combined`). Usa los mismos
+    /// umbrales que `suggested_lod`: 0.75/0.5/0.25 → base mip 0/1/2/3.
+    pub fn set_importance(&mut self, id: AssetId, importance: f32) {
+        if let Some(state) = self.textures.get_mut(&id) {
+            state.importance = importance.clamp(0.0, 1.0);
+        }
+    }
+
+    fn importance_base_mip(importance: f32) -> u32 {
+        if importance > 0.75 {
+            0
+        } else if importance > 0.5 {
+            1
+        } else if importance > 0.25 {
+            2
+        } else {
+            3
+        }
+    }
+
+    /// Bytes actualmente residentes según el estado trackeado.
+    pub fn resident_bytes(&self) -> u64 {
+        self.textures
+            .values()
+            .map(|s| s.desc.bytes_from_mip(s.resident_base_mip))
+            .sum()
+    }
+
+    pub fn stats(&self) -> ResidencyStats {
+        self.stats
+    }
+
+    /// Replanifica la residencia contra el budget consultado y emite los
+    /// comandos necesarios. Llamar una vez por frame (o cada N frames).
+    ///
+    /// 1. Cada textura apunta al base mip que sugiere su importancia.
+    /// 2. Si la suma excede el budget, se degradan mips altos empezando por
+    ///    las texturas menos importantes y más frías, hasta entrar o hasta
+    ///    que todas queden en su mip tail.
+    /// 3. Se emiten `Evict` antes que `StreamIn` para que la VRAM se libere
+    ///    antes de ocuparse.
+    pub fn update(&mut self, budget: &GpuMemoryBudget, frame: u64) -> Vec<ResidencyCommand> {
+        let budget_bytes =
+            (budget.total_vram_budget() as f64 * self.budget_fraction as f64) as u64;
+        self.update_with_budget_bytes(budget_bytes, frame)
+    }
+
+    /// Variante con budget explícito en bytes (tests y tuning manual).
+    pub fn update_with_budget_bytes(
+        &mut self,
+        budget_bytes: u64,
+        frame: u64,
+    ) -> Vec<ResidencyCommand> {
+        // Paso 1: target por importancia, acotado al mip tail protegido.
+        for state in self.textures.values_mut() {
+            let floor = state.desc.floor_mip(self.min_resident_mips);
+            state.target_base_mip = Self::importance_base_mip(state.importance).min(floor);
+        }
+
+        // Paso 2: degradar hasta entrar en budget. Candidato de desalojo:
+        // menor importancia primero, y a igual importancia el más frío.
+        let mut planned: u64 = self
+            .textures
+            .values()
+            .map(|s| s.desc.bytes_from_mip(s.target_base_mip))
+            .sum();
+
+        while planned > budget_bytes {
+            let candidate = self
+                .textures
+                .iter()
+                .filter(|(_, s)| s.target_base_mip < s.desc.floor_mip(self.min_resident_mips))
+                .min_by(|(_, a), (_, b)| {
+                    a.importance
+                        .partial_cmp(&b.importance)
+                        .unwrap_or(std::cmp::Ordering::Equal)
+                        .then(a.last_used_frame.cmp(&b.last_used_frame))
+                })
+                .map(|(id, _)| *id);
+
+            let Some(id) = candidate else {
+                break; // todas en su mip tail: no hay más que soltar
+            };
+            let state = self.textures.get_mut(&id).unwrap();
+            let before = state.desc.bytes_from_mip(state.target_base_mip);
+            state.target_base_mip += 1;
+            planned -= before - state.desc.bytes_from_mip(state.target_base_mip);
+        }
+
+        // Paso 3: emitir comandos (Evict primero) y asumir el nuevo estado.
+        let mut evictions = Vec::new();
+        let mut stream_ins = Vec::new();
+        for (id, state) in self.textures.iter_mut() {
+            if state.target_base_mip > state.resident_base_mip {
+                evictions.push(ResidencyCommand::Evict {
+                    id: *id,
+                    base_mip: state.target_base_mip,
+                });
+                state.resident_base_mip = state.target_base_mip;
+            } else if state.target_base_mip < state.resident_base_mip {
+                stream_ins.push((
+                    state.importance,
+                    ResidencyCommand::StreamIn {
+                        id: *id,
+                        base_mip: state.target_base_mip,
+                    },
+                ));
+                state.resident_base_mip = state.target_base_mip;
+            }
+        }
+        // Los stream-ins más importantes primero: si el frame se corta,
+        // lo visible gana.
+        stream_ins.sort_by(|(a, _), (b, _)| b.partial_cmp(a).unwrap_or(std::cmp::Ordering::Equal));
+
+        self.stats = ResidencyStats {
+            registered: self.textures.len(),
+            resident_bytes: self.resident_bytes(),
+            budget_bytes,
+            streamed_in: stream_ins.len(),
+            evicted: evictions.len(),
+        };
+        let _ = frame;
+
+        evictions
+            .into_iter()
+            .chain(stream_ins.into_iter().map(|(_, cmd)| cmd))
+            .collect()
+    }
+}
+
+impl Default for TextureResidencyManager {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+// =============================================================================
+// Tests
+// =============================================================================
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn desc_2k() -> TextureResidencyDesc {
+        TextureResidencyDesc {
+            width: 2048,
+            height: 2048,
+            mip_levels: 12,
+            bytes_per_pixel: 4,
+        }
+    }
+
+    #[test]
+    fn test_full_chain_fits_in_generous_budget() {
+        let mut mgr = TextureResidencyManager::new();
+        let id = AssetId::from_path("a.ktx2");
+        mgr.register(id, desc_2k(), 0);
+        mgr.set_importance(id, 1.0);
+
+        let cmds = mgr.update_with_budget_bytes(1 << 30, 1);
+        assert!(cmds.is_empty(), "nothing to do under budget: {:?}", cmds);
+        assert_eq!(mgr.resident_bytes(), desc_2k().bytes_from_mip(0));
+    }
+
+    #[test]
+    fn test_low_importance_texture_is_evicted_first() {
+        let mut mgr = TextureResidencyManager::new();
+        let near = AssetId::from_path("near.ktx2");
+        let far = AssetId::from_path("far.ktx2");
+        mgr.register(near, desc_2k(), 0);
+        mgr.register(far, desc_2k(), 0);
+        mgr.set_importance(near, 1.0);
+        mgr.set_importance(far, 0.1);
+
+        // Budget para una textura completa y media: la lejana degrada.
+        let budget = desc_2k().bytes_from_mip(0) * 3 / 2;
+        let cmds = mgr.update_with_budget_bytes(budget, 1);
+
+        assert!(cmds.iter().all(|c| match c {
+            ResidencyCommand::Evict { id, .. } => *id == far,
+            ResidencyCommand::StreamIn { .. } => false,
+        }));
+        assert!(mgr.resident_bytes() <= budget);
+    }
+
+    #[test]
+    fn test_mip_tail_is_never_evicted() {
+        let mut mgr = TextureResidencyManager::new();
+        let id = AssetId::from_path("tiny_budget.ktx2");
+        mgr.register(id, desc_2k(), 0);
+        mgr.set_importance(id, 0.0);
+
+        // Budget imposible: aún así el mip tail queda residente.
+        let cmds = mgr.update_with_budget_bytes(0, 1);
+        let tail_mip = desc_2k().mip_levels - DEFAULT_MIN_RESIDENT_MIPS;
+        assert_eq!(
+            cmds,
+            vec![ResidencyCommand::Evict { id, base_mip: tail_mip }]
+        );
+        assert_eq!(mgr.resident_bytes(), desc_2k().bytes_from_mip(tail_mip));
+    }
+
+    #[test]
+    fn test_importance_recovery_streams_back_in() {
+        let mut mgr = TextureResidencyManager::new();
+        let id = AssetId::from_path("comeback.ktx2");
+        mgr.register(id, desc_2k(), 0);
+        mgr.set_importance(id, 0.1);
+        mgr.update_with_budget_bytes(1 << 30, 1);
+
+        mgr.set_importance(id, 1.0);
+        let cmds = mgr.update_with_budget_bytes(1 << 30, 2);
+        assert_eq!(cmds, vec![ResidencyCommand::StreamIn { id, base_mip: 0 }]);
+    }
+}
@@ -89,6 +89,82 @@ pub(super) fn copy_buffer_to_image(
     Ok(())
 }
 
+/// Copia un staging buffer que contiene una cadena de mips completa hacia
+/// `image` (una región por nivel, un solo submit). Usado por el streaming de
+/// residencia al re-subir una textura KTX2 desde otro base mip.
+pub(super) fn copy_buffer_to_image_levels(
+    ctx: &VulkanContext,
+    buffer: vk::Buffer,
+    image: vk::Image,
+    regions: &[vk::BufferImageCopy],
+    mip_levels: u32,
+) -> ReactorResult<()> {
+    let pool_info = vk::CommandPoolCreateInfo::default()
+        .queue_family_index(ctx.queue_family_index)
+        .flags(vk::CommandPoolCreateFlags::TRANSIENT);
+    let command_pool = unsafe { ctx.device.create_command_pool(&pool_info, None)? };
+
+    let alloc_info = vk::CommandBufferAllocateInfo::default()
+        .level(vk::CommandBufferLevel::PRIMARY)
+        .command_pool(command_pool)
+        .command_buffer_count(1);
+
+    let command_buffer = unsafe { ctx.device.allocate_command_buffers(&alloc_info)?[0] };
+
+    let begin_info = vk::CommandBufferBeginInfo::default()
+        .flags(vk::CommandBufferUsageFlags::ONE_TIME_SUBMIT);
+
+    unsafe {
+        ctx.device.begin_command_buffer(command_buffer, &begin_info)?;
+
+        let barrier = vk::ImageMemoryBarrier::default()
+            .old_layout(vk::ImageLayout::UNDEFINED)
+            .new_layout(vk::ImageLayout::TRANSFER_DST_OPTIMAL)
+            .src_queue_family_index(vk::QUEUE_FAMILY_IGNORED)
+            .dst_queue_family_index(vk::QUEUE_FAMILY_IGNORED)
+            .image(image)
+            .subresource_range(
+                vk::ImageSubresourceRange::default()
+                    .aspect_mask(vk::ImageAspectFlags::COLOR)
+                    .base_mip_level(0)
+                    .level_count(mip_levels)
+                    .base_array_layer(0)
+                    .layer_count(1),
+            )
+            .src_access_mask(vk::AccessFlags::empty())
+            .dst_access_mask(vk::AccessFlags::TRANSFER_WRITE);
+
+        ctx.device.cmd_pipeline_barrier(
+            command_buffer,
+            vk::PipelineStageFlags::TOP_OF_PIPE,
+            vk::PipelineStageFlags::TRANSFER,
+            vk::DependencyFlags::empty(),
+            &[],
+            &[],
+            &[barrier],
+        );
+
+        ctx.device.cmd_copy_buffer_to_image(
+            command_buffer,
+            buffer,
+            image,
+            vk::ImageLayout::TRANSFER_DST_OPTIMAL,
+            regions,
+        );
+
+        ctx.device.end_command_buffer(command_buffer)?;
+
+        let command_buffers = [command_buffer];
+        let submit_info = vk::SubmitInfo::default().command_buffers(&command_buffers);
+        ctx.device
+            .queue_submit(ctx.graphics_queue, &[submit_info], vk::Fence::null())?;
+        ctx.device.queue_wait_idle(ctx.graphics_queue)?;
+        ctx.device.destroy_command_pool(command_pool, None);
+    }
+
+    Ok(())
+}
+
 pub(super) fn transition_to_shader_read(
     ctx: &VulkanContext,
     image: vk::Image,
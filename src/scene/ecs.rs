@@ -1,14 +1,152 @@
+use crate::core::jobs;
 use std::any::{Any, TypeId};
 use std::collections::HashMap;
+use std::marker::PhantomData;
 
 pub type Entity = u32;
 
+/// Chunk size for `par_query` / `par_query_mut`. Big enough to amortize
+/// rayon scheduling, small enough to load-balance uneven per-entity work.
+const PAR_QUERY_CHUNK: usize = 1024;
+
 pub trait Component: Any + Send + Sync {}
 impl<T: Any + Send + Sync> Component for T {}
 
+const INVALID_INDEX: u32 = u32::MAX;
+
+// =============================================================================
+// Sparse-set component storage
+// =============================================================================
+
+/// Dense storage for one component type.
+///
+/// `entities` and `dense` are parallel arrays, so iteration touches
+/// contiguous memory; per-entity lookup is a single indexed read through
+/// `sparse`. Removal is swap-remove, which keeps the dense arrays packed.
+pub struct SparseSet<T> {
+    /// Entity id → dense index (`INVALID_INDEX` = not present).
+    sparse: Vec<u32>,
+    /// Dense index → entity id.
+    entities: Vec<Entity>,
+    /// Component data, packed.
+    dense: Vec<T>,
+}
+
+impl<T> SparseSet<T> {
+    fn new() -> Self {
+        Self {
+            sparse: Vec::new(),
+            entities: Vec::new(),
+            dense: Vec::new(),
+        }
+    }
+
+    fn insert(&mut self, entity: Entity, component: T) {
+        let id = entity as usize;
+        if id >= self.sparse.len() {
+            self.sparse.resize(id + 1, INVALID_INDEX);
+        }
+        let slot = self.sparse[id];
+        if slot != INVALID_INDEX {
+            self.dense[slot as usize] = component;
+        } else {
+            self.sparse[id] = self.dense.len() as u32;
+            self.entities.push(entity);
+            self.dense.push(component);
+        }
+    }
+
+    fn remove(&mut self, entity: Entity) -> Option<T> {
+        let slot = self.index_of(entity)?;
+        self.sparse[entity as usize] = INVALID_INDEX;
+        self.entities.swap_remove(slot);
+        let component = self.dense.swap_remove(slot);
+        // Patch the sparse entry of the element that was swapped into `slot`.
+        if let Some(&moved) = self.entities.get(slot) {
+            self.sparse[moved as usize] = slot as u32;
+        }
+        Some(component)
+    }
+
+    #[inline]
+    fn index_of(&self, entity: Entity) -> Option<usize> {
+        match self.sparse.get(entity as usize) {
+            Some(&slot) if slot != INVALID_INDEX => Some(slot as usize),
+            _ => None,
+        }
+    }
+
+    #[inline]
+    pub fn contains(&self, entity: Entity) -> bool {
+        self.index_of(entity).is_some()
+    }
+
+    #[inline]
+    pub fn get(&self, entity: Entity) -> Option<&T> {
+        self.index_of(entity).map(|i| &self.dense[i])
+    }
+
+    #[inline]
+    pub fn get_mut(&mut self, entity: Entity) -> Option<&mut T> {
+        self.index_of(entity).map(|i| &mut self.dense[i])
+    }
+
+    #[inline]
+    pub fn len(&self) -> usize {
+        self.dense.len()
+    }
+
+    #[inline]
+    pub fn is_empty(&self) -> bool {
+        self.dense.is_empty()
+    }
+
+    /// Entity ids in dense order (parallel to `components()`).
+    #[inline]
+    pub fn entities(&self) -> &[Entity] {
+        &self.entities
+    }
+
+    /// Packed component array in dense order.
+    #[inline]
+    pub fn components(&self) -> &[T] {
+        &self.dense
+    }
+
+    /// Packed component array in dense order, mutable.
+    #[inline]
+    pub fn components_mut(&mut self) -> &mut [T] {
+        &mut self.dense
+    }
+}
+
+/// Type-erased interface so `World` can clean up components on
+/// `destroy_entity` without knowing the concrete component type.
+trait ComponentStorage: Send + Sync {
+    fn as_any(&self) -> &dyn Any;
+    fn as_any_mut(&mut self) -> &mut dyn Any;
+    fn remove_entity(&mut self, entity: Entity);
+}
+
+impl<T: Component> ComponentStorage for SparseSet<T> {
+    fn as_any(&self) -> &dyn Any {
+        self
+    }
+    fn as_any_mut(&mut self) -> &mut dyn Any {
+        self
+    }
+    fn remove_entity(&mut self, entity: Entity) {
+        self.remove(entity);
+    }
+}
+
+// =============================================================================
+// World
+// =============================================================================
+
 pub struct World {
     next_entity_id: Entity,
-    components: HashMap<TypeId, Box<dyn Any + Send + Sync>>,
+    components: HashMap<TypeId, Box<dyn ComponentStorage>>,
     entities: Vec<Entity>,
 }
 
@@ -30,84 +168,190 @@ impl World {
 
     pub fn destroy_entity(&mut self, entity: Entity) {
         self.entities.retain(|&e| e != entity);
-        // Note: Components are not automatically removed
-        // A proper ECS would handle this
+        for store in self.components.values_mut() {
+            store.remove_entity(entity);
+        }
     }
 
     pub fn entity_count(&self) -> usize {
         self.entities.len()
     }
 
+    fn store<T: Component>(&self) -> Option<&SparseSet<T>> {
+        self.components
+            .get(&TypeId::of::<T>())
+            .and_then(|s| s.as_any().downcast_ref::<SparseSet<T>>())
+    }
+
+    fn store_mut<T: Component>(&mut self) -> Option<&mut SparseSet<T>> {
+        self.components
+            .get_mut(&TypeId::of::<T>())
+            .and_then(|s| s.as_any_mut().downcast_mut::<SparseSet<T>>())
+    }
+
     pub fn register_component<T: Component>(&mut self) {
-        let type_id = TypeId::of::<T>();
         self.components
-            .entry(type_id)
-            .or_insert_with(|| Box::new(HashMap::<Entity, T>::new()));
+            .entry(TypeId::of::<T>())
+            .or_insert_with(|| Box::new(SparseSet::<T>::new()));
     }
 
     pub fn add_component<T: Component>(&mut self, entity: Entity, component: T) {
-        let type_id = TypeId::of::<T>();
-        if let Some(store) = self.components.get_mut(&type_id) {
-            if let Some(map) = store.downcast_mut::<HashMap<Entity, T>>() {
-                map.insert(entity, component);
-            }
-        } else {
-            let mut map = HashMap::<Entity, T>::new();
-            map.insert(entity, component);
-            self.components.insert(type_id, Box::new(map));
-        }
+        self.register_component::<T>();
+        self.store_mut::<T>()
+            .expect("store registered above")
+            .insert(entity, component);
     }
 
     pub fn remove_component<T: Component>(&mut self, entity: Entity) -> Option<T> {
-        let type_id = TypeId::of::<T>();
-        if let Some(store) = self.components.get_mut(&type_id) {
-            if let Some(map) = store.downcast_mut::<HashMap<Entity, T>>() {
-                return map.remove(&entity);
-            }
-        }
-        None
+        self.store_mut::<T>()?.remove(entity)
     }
 
     pub fn get_component<T: Component>(&self, entity: Entity) -> Option<&T> {
-        let type_id = TypeId::of::<T>();
-        if let Some(store) = self.components.get(&type_id) {
-            if let Some(map) = store.downcast_ref::<HashMap<Entity, T>>() {
-                return map.get(&entity);
-            }
-        }
-        None
+        self.store::<T>()?.get(entity)
     }
 
     pub fn get_component_mut<T: Component>(&mut self, entity: Entity) -> Option<&mut T> {
-        let type_id = TypeId::of::<T>();
-        if let Some(store) = self.components.get_mut(&type_id) {
-            if let Some(map) = store.downcast_mut::<HashMap<Entity, T>>() {
-                return map.get_mut(&entity);
-            }
-        }
-        None
+        self.store_mut::<T>()?.get_mut(entity)
     }
 
     pub fn has_component<T: Component>(&self, entity: Entity) -> bool {
-        self.get_component::<T>(entity).is_some()
+        self.store::<T>().is_some_and(|s| s.contains(entity))
     }
 
+    /// Direct access to the packed storage of one component type.
+    /// Useful for systems that want to hand the dense arrays to SIMD or
+    /// job-system code without going through the iterator APIs.
+    pub fn storage<T: Component>(&self) -> Option<&SparseSet<T>> {
+        self.store::<T>()
+    }
+
+    /// Mutable counterpart of [`World::storage`].
+    pub fn storage_mut<T: Component>(&mut self) -> Option<&mut SparseSet<T>> {
+        self.store_mut::<T>()
+    }
+
+    // -------------------------------------------------------------------------
+    // Queries
+    // -------------------------------------------------------------------------
+
     pub fn query<T: Component>(&self) -> impl Iterator<Item = (Entity, &T)> {
-        let type_id = TypeId::of::<T>();
-        self.components
-            .get(&type_id)
-            .and_then(|store| store.downcast_ref::<HashMap<Entity, T>>())
+        self.store::<T>()
             .into_iter()
-            .flat_map(|map| map.iter().map(|(&e, c)| (e, c)))
+            .flat_map(|s| s.entities.iter().copied().zip(s.dense.iter()))
     }
 
     pub fn query_mut<T: Component>(&mut self) -> impl Iterator<Item = (Entity, &mut T)> {
-        let type_id = TypeId::of::<T>();
-        self.components
-            .get_mut(&type_id)
-            .and_then(|store| store.downcast_mut::<HashMap<Entity, T>>())
+        self.store_mut::<T>()
             .into_iter()
-            .flat_map(|map| map.iter_mut().map(|(&e, c)| (e, c)))
+            .flat_map(|s| s.entities.iter().copied().zip(s.dense.iter_mut()))
+    }
+
+    /// Run `body` over every `T` in parallel across the job system.
+    ///
+    /// The dense component array is split into chunks that are dispatched to
+    /// rayon workers, so per-entity work scales across cores instead of
+    /// running serially like [`World::query`].
+    pub fn par_query<T: Component>(&self, body: impl Fn(Entity, &T) + Send + Sync) {
+        if let Some(s) = self.store::<T>() {
+            jobs::par_chunks_zip(&s.entities, &s.dense, PAR_QUERY_CHUNK, |entities, comps| {
+                for (&e, c) in entities.iter().zip(comps) {
+                    body(e, c);
+                }
+            });
+        }
+    }
+
+    /// Parallel mutable counterpart of [`World::par_query`].
+    ///
+    /// Each worker receives a disjoint `&mut` chunk of the dense array
+    /// (rayon's `par_chunks_mut` split), so no two invocations of `body`
+    /// ever see the same component.
+    pub fn par_query_mut<T: Component>(&mut self, body: impl Fn(Entity, &mut T) + Send + Sync) {
+        if let Some(s) = self.store_mut::<T>() {
+            let SparseSet {
+                entities, dense, ..
+            } = s;
+            jobs::par_chunks_zip_mut(entities, dense, PAR_QUERY_CHUNK, |entities, comps| {
+                for (&e, c) in entities.iter().zip(comps.iter_mut()) {
+                    body(e, c);
+                }
+            });
+        }
+    }
+
+    /// Chunk-granular parallel mutable query for SIMD-friendly inner loops.
+    /// `body` gets the entity-id slice and the matching mutable component
+    /// slice of each chunk, avoiding per-element closure overhead.
+    pub fn par_query_chunks_mut<T: Component>(
+        &mut self,
+        chunk_size: usize,
+        body: impl Fn(&[Entity], &mut [T]) + Send + Sync,
+    ) {
+        if let Some(s) = self.store_mut::<T>() {
+            let SparseSet {
+                entities, dense, ..
+            } = s;
+            jobs::par_chunks_zip_mut(entities, dense, chunk_size, body);
+        }
+    }
+
+    /// Iterate all entities that have both `A` and `B`.
+    ///
+    /// `A`'s dense array drives the iteration and `B` is probed through its
+    /// sparse index, so put the rarer component first for the tightest loop.
+    pub fn query2<A: Component, B: Component>(&self) -> impl Iterator<Item = (Entity, &A, &B)> {
+        let b = self.store::<B>();
+        self.store::<A>().into_iter().flat_map(move |sa| {
+            sa.entities
+                .iter()
+                .copied()
+                .zip(sa.dense.iter())
+                .filter_map(move |(e, ca)| Some((e, ca, b?.get(e)?)))
+        })
+    }
+
+    /// Iterate all entities that have `A`, `B` and `C`. `A` drives.
+    pub fn query3<A: Component, B: Component, C: Component>(
+        &self,
+    ) -> impl Iterator<Item = (Entity, &A, &B, &C)> {
+        let b = self.store::<B>();
+        let c = self.store::<C>();
+        self.store::<A>().into_iter().flat_map(move |sa| {
+            sa.entities
+                .iter()
+                .copied()
+                .zip(sa.dense.iter())
+                .filter_map(move |(e, ca)| Some((e, ca, b?.get(e)?, c?.get(e)?)))
+        })
+    }
+
+    /// Iterate all entities that have both `A` and `B`, with mutable access
+    /// to both components.
+    ///
+    /// # Panics
+    /// Panics if `A` and `B` are the same type (that would alias).
+    pub fn query2_mut<A: Component, B: Component>(&mut self) -> Query2Mut<'_, A, B> {
+        assert_ne!(
+            TypeId::of::<A>(),
+            TypeId::of::<B>(),
+            "query2_mut requires two distinct component types"
+        );
+        // The assert above guarantees the two stores are distinct HashMap
+        // entries, so the raw pointers below never alias.
+        let a = self
+            .store_mut::<A>()
+            .map(|s| s as *mut SparseSet<A>)
+            .unwrap_or(std::ptr::null_mut());
+        let b = self
+            .store_mut::<B>()
+            .map(|s| s as *mut SparseSet<B>)
+            .unwrap_or(std::ptr::null_mut());
+        Query2Mut {
+            a,
+            b,
+            index: 0,
+            _world: PhantomData,
+        }
     }
 }
 
@@ -116,3 +360,121 @@ impl Default for World {
         Self::new()
     }
 }
+
+/// Iterator returned by [`World::query2_mut`].
+///
+/// Safety invariants: the two stores are distinct (asserted at construction),
+/// each entity appears at most once per store, and the `PhantomData` keeps the
+/// `World` mutably borrowed for the iterator's lifetime — so every `&mut`
+/// handed out refers to a unique slot.
+pub struct Query2Mut<'w, A, B> {
+    a: *mut SparseSet<A>,
+    b: *mut SparseSet<B>,
+    index: usize,
+    _world: PhantomData<&'w mut World>,
+}
+
+impl<'w, A: Component, B: Component> Iterator for Query2Mut<'w, A, B> {
+    type Item = (Entity, &'w mut A, &'w mut B);
+
+    fn next(&mut self) -> Option<Self::Item> {
+        if self.a.is_null() || self.b.is_null() {
+            return None;
+        }
+        unsafe {
+            let sa = &mut *self.a;
+            while self.index < sa.entities.len() {
+                let i = self.index;
+                self.index += 1;
+                let entity = sa.entities[i];
+                if let Some(cb) = (*self.b).get_mut(entity) {
+                    let ca = &mut *sa.dense.as_mut_ptr().add(i);
+                    let cb = &mut *(cb as *mut B);
+                    return Some((entity, ca, cb));
+                }
+            }
+        }
+        None
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[derive(Debug, PartialEq)]
+    struct Pos(f32);
+    #[derive(Debug, PartialEq)]
+    struct Vel(f32);
+
+    #[test]
+    fn test_sparse_set_swap_remove_keeps_dense_packed() {
+        let mut set = SparseSet::new();
+        set.insert(0, Pos(0.0));
+        set.insert(1, Pos(1.0));
+        set.insert(2, Pos(2.0));
+
+        assert_eq!(set.remove(0), Some(Pos(0.0)));
+        assert_eq!(set.len(), 2);
+        // Entity 2 was swapped into slot 0; lookups must still resolve.
+        assert_eq!(set.get(2), Some(&Pos(2.0)));
+        assert_eq!(set.get(1), Some(&Pos(1.0)));
+        assert_eq!(set.get(0), None);
+    }
+
+    #[test]
+    fn test_query2_joins_only_matching_entities() {
+        let mut world = World::new();
+        let a = world.create_entity();
+        let b = world.create_entity();
+        let c = world.create_entity();
+        world.add_component(a, Pos(1.0));
+        world.add_component(b, Pos(2.0));
+        world.add_component(c, Pos(3.0));
+        world.add_component(a, Vel(10.0));
+        world.add_component(c, Vel(30.0));
+
+        let mut hits: Vec<Entity> = world.query2::<Pos, Vel>().map(|(e, _, _)| e).collect();
+        hits.sort_unstable();
+        assert_eq!(hits, vec![a, c]);
+    }
+
+    #[test]
+    fn test_query2_mut_writes_both_components() {
+        let mut world = World::new();
+        let e = world.create_entity();
+        world.add_component(e, Pos(0.0));
+        world.add_component(e, Vel(5.0));
+
+        for (_, pos, vel) in world.query2_mut::<Pos, Vel>() {
+            pos.0 += vel.0;
+            vel.0 = 0.0;
+        }
+        assert_eq!(world.get_component::<Pos>(e), Some(&Pos(5.0)));
+        assert_eq!(world.get_component::<Vel>(e), Some(&Vel(0.0)));
+    }
+
+    #[test]
+    fn test_par_query_mut_touches_every_component() {
+        let mut world = World::new();
+        for i in 0..10_000 {
+            let e = world.create_entity();
+            world.add_component(e, Pos(i as f32));
+        }
+        world.par_query_mut::<Pos>(|_, pos| pos.0 += 1.0);
+
+        let sum: f32 = world.query::<Pos>().map(|(_, p)| p.0).sum();
+        let expected: f32 = (0..10_000).map(|i| i as f32 + 1.0).sum();
+        assert_eq!(sum, expected);
+    }
+
+    #[test]
+    fn test_destroy_entity_removes_components() {
+        let mut world = World::new();
+        let e = world.create_entity();
+        world.add_component(e, Pos(1.0));
+        world.destroy_entity(e);
+        assert_eq!(world.get_component::<Pos>(e), None);
+        assert_eq!(world.entity_count(), 0);
+    }
+}
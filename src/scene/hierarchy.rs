@@ -0,0 +1,205 @@
+// =============================================================================
+// REACTOR Transform Hierarchy — cached world matrices with dirty propagation
+// =============================================================================
+// Flat parent-before-child storage: node `i` always has `parent(i) < i`, so a
+// single forward pass over the arrays resolves every chain. World matrices are
+// cached and only recomputed for subtrees whose local transform changed since
+// the last `update_world_matrices()` — the renderer and physics read the
+// cached matrices for free.
+// =============================================================================
+
+use crate::scene::transform::Transform;
+use glam::Mat4;
+
+/// Index of a node inside a [`TransformHierarchy`].
+pub type NodeId = u32;
+
+/// Parent value for root nodes.
+const NO_PARENT: u32 = u32::MAX;
+
+/// Cached transform hierarchy.
+///
+/// Locals, parents, world matrices and dirty flags live in flat arrays in
+/// allocation order, which is guaranteed to be parent-before-child. The
+/// update is a single cache-friendly sweep; untouched subtrees cost one
+/// flag check per node.
+pub struct TransformHierarchy {
+    locals: Vec<Transform>,
+    worlds: Vec<Mat4>,
+    parents: Vec<u32>,
+    dirty: Vec<bool>,
+    any_dirty: bool,
+}
+
+impl TransformHierarchy {
+    pub fn new() -> Self {
+        Self {
+            locals: Vec::new(),
+            worlds: Vec::new(),
+            parents: Vec::new(),
+            dirty: Vec::new(),
+            any_dirty: false,
+        }
+    }
+
+    pub fn with_capacity(capacity: usize) -> Self {
+        Self {
+            locals: Vec::with_capacity(capacity),
+            worlds: Vec::with_capacity(capacity),
+            parents: Vec::with_capacity(capacity),
+            dirty: Vec::with_capacity(capacity),
+            any_dirty: false,
+        }
+    }
+
+    /// Add a node. `parent` must already exist, which keeps the arrays in
+    /// parent-before-child order by construction.
+    pub fn add_node(&mut self, parent: Option<NodeId>, local: Transform) -> NodeId {
+        let parent_index = match parent {
+            Some(p) => {
+                debug_assert!((p as usize) < self.locals.len(), "parent must exist");
+                p
+            }
+            None => NO_PARENT,
+        };
+        self.locals.push(local);
+        self.worlds.push(Mat4::IDENTITY);
+        self.parents.push(parent_index);
+        self.dirty.push(true);
+        self.any_dirty = true;
+        (self.locals.len() - 1) as NodeId
+    }
+
+    pub fn len(&self) -> usize {
+        self.locals.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.locals.is_empty()
+    }
+
+    pub fn parent(&self, node: NodeId) -> Option<NodeId> {
+        let p = self.parents[node as usize];
+        (p != NO_PARENT).then_some(p)
+    }
+
+    pub fn local(&self, node: NodeId) -> &Transform {
+        &self.locals[node as usize]
+    }
+
+    /// Mutable access to a node's local transform. Marks its subtree dirty.
+    pub fn local_mut(&mut self, node: NodeId) -> &mut Transform {
+        self.dirty[node as usize] = true;
+        self.any_dirty = true;
+        &mut self.locals[node as usize]
+    }
+
+    pub fn set_local(&mut self, node: NodeId, local: Transform) {
+        *self.local_mut(node) = local;
+    }
+
+    /// Cached world matrix. Valid after the last `update_world_matrices()`.
+    pub fn world_matrix(&self, node: NodeId) -> &Mat4 {
+        &self.worlds[node as usize]
+    }
+
+    /// All cached world matrices, indexed by [`NodeId`]. This is what the
+    /// renderer uploads and what physics reads.
+    pub fn world_matrices(&self) -> &[Mat4] {
+        &self.worlds
+    }
+
+    /// Recompute world matrices for every dirty subtree. Returns how many
+    /// nodes were recomputed (zero when nothing moved).
+    ///
+    /// One forward pass: because parents precede children, a parent's fresh
+    /// world matrix is always available when its children are visited, and
+    /// dirtiness propagates down the chain by OR-ing the parent's flag in.
+    pub fn update_world_matrices(&mut self) -> usize {
+        if !self.any_dirty {
+            return 0;
+        }
+
+        let mut updated = 0;
+        for i in 0..self.locals.len() {
+            let parent = self.parents[i];
+            if parent != NO_PARENT && self.dirty[parent as usize] {
+                self.dirty[i] = true;
+            }
+            if !self.dirty[i] {
+                continue;
+            }
+            let local = self.locals[i].matrix();
+            self.worlds[i] = if parent == NO_PARENT {
+                local
+            } else {
+                self.worlds[parent as usize] * local
+            };
+            updated += 1;
+        }
+
+        // Flags are needed during the pass for downward propagation, so
+        // clearing is a second (branch-free) sweep.
+        self.dirty.fill(false);
+        self.any_dirty = false;
+        updated
+    }
+}
+
+impl Default for TransformHierarchy {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use glam::Vec3;
+
+    #[test]
+    fn world_matrices_chain_through_parents() {
+        let mut h = TransformHierarchy::new();
+        let root = h.add_node(None, Transform::from_translation(1.0, 0.0, 0.0));
+        let child = h.add_node(Some(root), Transform::from_translation(0.0, 2.0, 0.0));
+        let grandchild = h.add_node(Some(child), Transform::from_translation(0.0, 0.0, 3.0));
+
+        assert_eq!(h.update_world_matrices(), 3);
+        let world = h.world_matrix(grandchild);
+        let pos = world.transform_point3(Vec3::ZERO);
+        assert!((pos - Vec3::new(1.0, 2.0, 3.0)).length() < 1e-5);
+    }
+
+    #[test]
+    fn only_dirty_subtrees_recompute() {
+        let mut h = TransformHierarchy::new();
+        let root_a = h.add_node(None, Transform::new());
+        let _child_a = h.add_node(Some(root_a), Transform::new());
+        let root_b = h.add_node(None, Transform::new());
+        let _child_b = h.add_node(Some(root_b), Transform::new());
+        h.update_world_matrices();
+
+        // Nothing changed → nothing recomputed.
+        assert_eq!(h.update_world_matrices(), 0);
+
+        // Moving root_b dirties its subtree but not root_a's.
+        h.local_mut(root_b).position = Vec3::new(5.0, 0.0, 0.0);
+        assert_eq!(h.update_world_matrices(), 2);
+
+        let pos = h.world_matrix(_child_b).transform_point3(Vec3::ZERO);
+        assert!((pos - Vec3::new(5.0, 0.0, 0.0)).length() < 1e-5);
+    }
+
+    #[test]
+    fn child_edit_does_not_touch_parent() {
+        let mut h = TransformHierarchy::new();
+        let root = h.add_node(None, Transform::from_translation(1.0, 0.0, 0.0));
+        let child = h.add_node(Some(root), Transform::new());
+        h.update_world_matrices();
+
+        h.local_mut(child).position = Vec3::new(0.0, 1.0, 0.0);
+        assert_eq!(h.update_world_matrices(), 1);
+        let pos = h.world_matrix(child).transform_point3(Vec3::ZERO);
+        assert!((pos - Vec3::new(1.0, 1.0, 0.0)).length() < 1e-5);
+    }
+}
@@ -4,8 +4,10 @@
 
 pub mod camera;
 pub mod ecs;
+pub mod hierarchy;
 pub mod transform;
 
 pub use camera::Camera;
 pub use ecs::{Component, Entity, World};
+pub use hierarchy::{NodeId, TransformHierarchy};
 pub use transform::Transform;
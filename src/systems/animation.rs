@@ -1,6 +1,9 @@
-use glam::{Quat, Vec3};
+use glam::{Mat4, Quat, Vec3};
 use std::collections::HashMap;
 
+use crate::core::jobs;
+use crate::scene::transform::Transform;
+
 /// Keyframe for animation
 #[derive(Clone, Debug)]
 pub struct Keyframe<T: Clone> {
@@ -40,6 +43,15 @@ impl<T: Clone + Interpolate> AnimationTrack<T> {
     }
 
     pub fn sample(&self, time: f32) -> Option<T> {
+        self.sample_with_cursor(time, &mut TrackCursor::default())
+    }
+
+    /// Sample using a playback cursor. Instead of re-searching the keyframe
+    /// list every call, the cursor remembers the segment the playhead was in
+    /// last frame and only walks forward from there — O(1) for normal
+    /// playback, falling back to a scan from the start when time jumps
+    /// backwards (loop wrap, seek).
+    pub fn sample_with_cursor(&self, time: f32, cursor: &mut TrackCursor) -> Option<T> {
         if self.keyframes.is_empty() {
             return None;
         }
@@ -62,16 +74,18 @@ impl<T: Clone + Interpolate> AnimationTrack<T> {
             }
         };
 
-        // Find surrounding keyframes
-        let mut prev_idx = 0;
-        for (i, kf) in self.keyframes.iter().enumerate() {
-            if kf.time <= t {
-                prev_idx = i;
-            } else {
-                break;
-            }
+        // Advance the cursor to the segment containing t.
+        if t < cursor.last_time {
+            cursor.index = 0;
+        }
+        cursor.last_time = t;
+        while cursor.index + 1 < self.keyframes.len()
+            && self.keyframes[cursor.index + 1].time <= t
+        {
+            cursor.index += 1;
         }
 
+        let prev_idx = cursor.index;
         let next_idx = (prev_idx + 1).min(self.keyframes.len() - 1);
 
         if prev_idx == next_idx {
@@ -100,6 +114,22 @@ pub enum LoopMode {
     PingPong,
 }
 
+/// Playback cursor for a single track. Caches the keyframe segment the
+/// playhead was in so the next sample resumes there instead of searching.
+#[derive(Clone, Copy, Debug, Default)]
+pub struct TrackCursor {
+    index: usize,
+    last_time: f32,
+}
+
+/// Playback cursors for the three tracks of a clip.
+#[derive(Clone, Copy, Debug, Default)]
+pub struct ClipCursor {
+    pub position: TrackCursor,
+    pub rotation: TrackCursor,
+    pub scale: TrackCursor,
+}
+
 /// Trait for interpolatable values
 pub trait Interpolate {
     fn interpolate(a: &Self, b: &Self, t: f32) -> Self;
@@ -161,10 +191,25 @@ impl AnimationClip {
     }
 
     pub fn sample(&self, time: f32) -> AnimationSample {
+        self.sample_with_cursor(time, &mut ClipCursor::default())
+    }
+
+    /// Sample all tracks through a playback cursor (see
+    /// [`AnimationTrack::sample_with_cursor`]).
+    pub fn sample_with_cursor(&self, time: f32, cursor: &mut ClipCursor) -> AnimationSample {
         AnimationSample {
-            position: self.position_track.as_ref().and_then(|t| t.sample(time)),
-            rotation: self.rotation_track.as_ref().and_then(|t| t.sample(time)),
-            scale: self.scale_track.as_ref().and_then(|t| t.sample(time)),
+            position: self
+                .position_track
+                .as_ref()
+                .and_then(|t| t.sample_with_cursor(time, &mut cursor.position)),
+            rotation: self
+                .rotation_track
+                .as_ref()
+                .and_then(|t| t.sample_with_cursor(time, &mut cursor.rotation)),
+            scale: self
+                .scale_track
+                .as_ref()
+                .and_then(|t| t.sample_with_cursor(time, &mut cursor.scale)),
         }
     }
 }
@@ -199,6 +244,8 @@ pub struct AnimationPlayer {
     pub time: f32,
     pub speed: f32,
     pub playing: bool,
+    /// Playback cursor into the current clip's tracks.
+    pub cursor: ClipCursor,
 }
 
 impl AnimationPlayer {
@@ -209,6 +256,7 @@ impl AnimationPlayer {
             time: 0.0,
             speed: 1.0,
             playing: false,
+            cursor: ClipCursor::default(),
         }
     }
 
@@ -221,6 +269,7 @@ impl AnimationPlayer {
             self.current_clip = Some(name.to_string());
             self.time = 0.0;
             self.playing = true;
+            self.cursor = ClipCursor::default();
         }
     }
 
@@ -265,7 +314,7 @@ impl AnimationPlayer {
             }
         }
 
-        Some(clip.sample(self.time))
+        Some(clip.sample_with_cursor(self.time, &mut self.cursor))
     }
 
     pub fn is_finished(&self) -> bool {
@@ -284,6 +333,83 @@ impl Default for AnimationPlayer {
     }
 }
 
+/// Batched animation evaluation for crowds.
+///
+/// Advances many [`AnimationPlayer`]s in parallel on the job system and
+/// collects the results into contiguous buffers: one [`AnimationSample`] slot
+/// per entity, and optionally one pose matrix per entity ready to upload as a
+/// GPU palette (see `compute::GpuSkinning`). Buffers are reused across frames
+/// so steady-state updates allocate nothing.
+pub struct AnimationBatch {
+    samples: Vec<Option<AnimationSample>>,
+    pose_matrices: Vec<[[f32; 4]; 4]>,
+}
+
+impl AnimationBatch {
+    pub fn new() -> Self {
+        Self {
+            samples: Vec::new(),
+            pose_matrices: Vec::new(),
+        }
+    }
+
+    /// Advance and sample every player in parallel. Each player keeps its own
+    /// playback cursor, so per-entity sampling stays incremental.
+    pub fn update(&mut self, players: &mut [AnimationPlayer], delta_time: f32) {
+        self.samples.clear();
+        self.samples.resize(players.len(), None);
+
+        let mut pairs: Vec<(&mut AnimationPlayer, &mut Option<AnimationSample>)> =
+            players.iter_mut().zip(self.samples.iter_mut()).collect();
+        jobs::par_iter_mut(&mut pairs, |(player, slot)| {
+            **slot = player.update(delta_time);
+        });
+    }
+
+    /// Samples from the last `update`, one slot per player (None when the
+    /// player was stopped or had no clip).
+    pub fn samples(&self) -> &[Option<AnimationSample>] {
+        &self.samples
+    }
+
+    /// Build a contiguous matrix per entity from the last `update`, filling
+    /// unanimated channels from the entity's base transform. The returned
+    /// slice has GPU-friendly layout (column-major mat4) for palette upload.
+    pub fn build_pose_matrices(&mut self, base_transforms: &[Transform]) -> &[[[f32; 4]; 4]] {
+        let count = self.samples.len().min(base_transforms.len());
+        self.pose_matrices.clear();
+        self.pose_matrices
+            .resize(count, Mat4::IDENTITY.to_cols_array_2d());
+
+        let keys: Vec<(&Option<AnimationSample>, &Transform)> = self.samples[..count]
+            .iter()
+            .zip(base_transforms[..count].iter())
+            .collect();
+        jobs::par_chunks_zip_mut(&keys, &mut self.pose_matrices, 256, |keys, out| {
+            for ((sample, base), matrix) in keys.iter().zip(out.iter_mut()) {
+                let (scale, rotation, position) = match sample {
+                    Some(s) => (
+                        s.scale.unwrap_or(base.scale),
+                        s.rotation.unwrap_or(base.rotation),
+                        s.position.unwrap_or(base.position),
+                    ),
+                    None => (base.scale, base.rotation, base.position),
+                };
+                *matrix = Mat4::from_scale_rotation_translation(scale, rotation, position)
+                    .to_cols_array_2d();
+            }
+        });
+
+        &self.pose_matrices
+    }
+}
+
+impl Default for AnimationBatch {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
 /// Tween for simple value animations
 pub struct Tween<T: Clone + Interpolate> {
     pub start: T,
@@ -400,3 +526,86 @@ impl EasingFunction {
         }
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn ramp_track() -> AnimationTrack<f32> {
+        let mut track = AnimationTrack::new();
+        track.loop_mode = LoopMode::Loop;
+        for i in 0..=10 {
+            track.add_keyframe(i as f32 * 0.1, i as f32);
+        }
+        track
+    }
+
+    #[test]
+    fn cursor_sampling_matches_stateless_sampling() {
+        let track = ramp_track();
+        let mut cursor = TrackCursor::default();
+
+        // Forward playback, including two loop wraps.
+        let mut time = 0.0;
+        while time < 2.5 {
+            let expected = track.sample(time).unwrap();
+            let got = track.sample_with_cursor(time, &mut cursor).unwrap();
+            assert!((expected - got).abs() < 1e-5, "t={time}");
+            time += 0.013;
+        }
+    }
+
+    #[test]
+    fn player_cursor_survives_clip_switch() {
+        let mut clip_a = AnimationClip::new("a");
+        let mut pos = AnimationTrack::new();
+        pos.add_keyframe(0.0, Vec3::ZERO);
+        pos.add_keyframe(1.0, Vec3::X);
+        clip_a.position_track = Some(pos);
+
+        let mut player = AnimationPlayer::new();
+        player.add_clip(clip_a.clone());
+        player.play("a");
+        player.update(0.9);
+
+        // Re-playing resets the cursor; sampling near t=0 must not reuse the
+        // old segment index.
+        player.play("a");
+        let sample = player.update(0.1).unwrap();
+        let p = sample.position.unwrap();
+        assert!((p.x - 0.1).abs() < 1e-5);
+    }
+
+    #[test]
+    fn batch_updates_all_players() {
+        let mut clip = AnimationClip::new("move");
+        let mut pos = AnimationTrack::new();
+        pos.add_keyframe(0.0, Vec3::ZERO);
+        pos.add_keyframe(1.0, Vec3::Y);
+        clip.position_track = Some(pos);
+
+        let mut players: Vec<AnimationPlayer> = (0..64)
+            .map(|_| {
+                let mut p = AnimationPlayer::new();
+                p.add_clip(clip.clone());
+                p.play("move");
+                p
+            })
+            .collect();
+
+        let mut batch = AnimationBatch::new();
+        batch.update(&mut players, 0.5);
+
+        assert_eq!(batch.samples().len(), 64);
+        for sample in batch.samples() {
+            let p = sample.as_ref().unwrap().position.unwrap();
+            assert!((p.y - 0.5).abs() < 1e-5);
+        }
+
+        let bases = vec![Transform::new(); 64];
+        let matrices = batch.build_pose_matrices(&bases);
+        assert_eq!(matrices.len(), 64);
+        // Column-major translation lives in the last column.
+        assert!((matrices[0][3][1] - 0.5).abs() < 1e-5);
+    }
+}
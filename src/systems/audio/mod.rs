@@ -1,5 +1,10 @@
+mod realtime;
 mod system;
 mod types;
 
+pub use realtime::{
+    audible_volume, rank_voices, spsc_channel, AudioCommand, AudioEvent, RealtimeAudio,
+    SpscConsumer, SpscProducer, VoiceId, VoiceMirror, VoiceParams,
+};
 pub use system::AudioSystem;
 pub use types::{AudioClip, AudioClipId, AudioListener, AudioSource, AudioSourceId};
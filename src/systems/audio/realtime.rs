@@ -0,0 +1,701 @@
+// =============================================================================
+// Realtime audio path — SPSC commands, pooled voices, virtualization
+// =============================================================================
+// The classic `AudioSystem` drives rodio from the main thread; every play or
+// parameter change touches the mixer directly, which spikes the frame under
+// dense event load. This module adds a real-time-safe path:
+//
+// - a lock-free SPSC ring carries commands from the game thread to a
+//   dedicated audio thread (and voice-finished events back),
+// - voices come from a fixed pool with generational handles, so `play()`
+//   never allocates,
+// - every audio tick ranks active voices by attenuated volume and keeps only
+//   the top `max_real_voices` mixed; the rest are virtualized (paused) and
+//   promoted back when their rank recovers.
+//
+// The game-thread handle mirrors voice positions/volumes so callers can feed
+// `ImportanceMap::set_audio_importance` without asking the audio thread.
+
+use std::cell::UnsafeCell;
+use std::collections::HashMap;
+use std::io::Cursor;
+use std::mem::MaybeUninit;
+use std::sync::atomic::{AtomicBool, AtomicUsize, Ordering};
+use std::sync::Arc;
+use std::time::Duration;
+
+use glam::Vec3;
+
+use crate::systems::audio::types::AudioClipId;
+
+// =============================================================================
+// Lock-free SPSC ring
+// =============================================================================
+
+/// Fixed-capacity single-producer single-consumer ring. `push` and `pop` are
+/// wait-free: one atomic load, one store, no locks and no allocation.
+struct SpscRing<T> {
+    buffer: Box<[UnsafeCell<MaybeUninit<T>>]>,
+    mask: usize,
+    head: AtomicUsize,
+    tail: AtomicUsize,
+}
+
+// The producer writes slots only between tail..head and the consumer reads
+// only published slots; indices are synchronized with Acquire/Release.
+unsafe impl<T: Send> Send for SpscRing<T> {}
+unsafe impl<T: Send> Sync for SpscRing<T> {}
+
+impl<T> SpscRing<T> {
+    fn new(capacity: usize) -> Self {
+        let capacity = capacity.next_power_of_two().max(2);
+        let buffer = (0..capacity)
+            .map(|_| UnsafeCell::new(MaybeUninit::uninit()))
+            .collect::<Vec<_>>()
+            .into_boxed_slice();
+        Self {
+            buffer,
+            mask: capacity - 1,
+            head: AtomicUsize::new(0),
+            tail: AtomicUsize::new(0),
+        }
+    }
+}
+
+impl<T> Drop for SpscRing<T> {
+    fn drop(&mut self) {
+        let head = self.head.load(Ordering::Relaxed);
+        let mut tail = self.tail.load(Ordering::Relaxed);
+        while tail != head {
+            unsafe {
+                (*self.buffer[tail & self.mask].get()).assume_init_drop();
+            }
+            tail = tail.wrapping_add(1);
+        }
+    }
+}
+
+/// Producer half of an SPSC channel. Not clonable; exactly one producer.
+pub struct SpscProducer<T> {
+    ring: Arc<SpscRing<T>>,
+}
+
+/// Consumer half of an SPSC channel.
+pub struct SpscConsumer<T> {
+    ring: Arc<SpscRing<T>>,
+}
+
+/// Create a lock-free SPSC channel. Capacity rounds up to a power of two.
+pub fn spsc_channel<T: Send>(capacity: usize) -> (SpscProducer<T>, SpscConsumer<T>) {
+    let ring = Arc::new(SpscRing::new(capacity));
+    (
+        SpscProducer { ring: ring.clone() },
+        SpscConsumer { ring },
+    )
+}
+
+impl<T: Send> SpscProducer<T> {
+    /// Push a value; returns it back if the ring is full (caller decides
+    /// whether to drop or retry — never block on the audio path).
+    pub fn push(&self, value: T) -> Result<(), T> {
+        let ring = &self.ring;
+        let head = ring.head.load(Ordering::Relaxed);
+        let tail = ring.tail.load(Ordering::Acquire);
+        if head.wrapping_sub(tail) > ring.mask {
+            return Err(value);
+        }
+        unsafe {
+            (*ring.buffer[head & ring.mask].get()).write(value);
+        }
+        ring.head.store(head.wrapping_add(1), Ordering::Release);
+        Ok(())
+    }
+}
+
+impl<T: Send> SpscConsumer<T> {
+    pub fn pop(&self) -> Option<T> {
+        let ring = &self.ring;
+        let tail = ring.tail.load(Ordering::Relaxed);
+        let head = ring.head.load(Ordering::Acquire);
+        if tail == head {
+            return None;
+        }
+        let value = unsafe { (*ring.buffer[tail & ring.mask].get()).assume_init_read() };
+        ring.tail.store(tail.wrapping_add(1), Ordering::Release);
+        Some(value)
+    }
+}
+
+// =============================================================================
+// Voice handles and commands
+// =============================================================================
+
+/// Generational handle into the voice pool. A stale handle (slot recycled)
+/// is ignored by the audio thread instead of touching the wrong sound.
+#[derive(Clone, Copy, Debug, PartialEq, Eq, Hash)]
+pub struct VoiceId {
+    pub index: u16,
+    pub generation: u16,
+}
+
+/// Parameters captured at `play` time. Plain data so the command fits the
+/// ring without allocation.
+#[derive(Clone, Copy, Debug)]
+pub struct VoiceParams {
+    pub volume: f32,
+    pub pitch: f32,
+    pub looping: bool,
+    pub spatial: bool,
+    pub position: Vec3,
+    pub min_distance: f32,
+    pub max_distance: f32,
+}
+
+impl Default for VoiceParams {
+    fn default() -> Self {
+        Self {
+            volume: 1.0,
+            pitch: 1.0,
+            looping: false,
+            spatial: true,
+            position: Vec3::ZERO,
+            min_distance: 1.0,
+            max_distance: 100.0,
+        }
+    }
+}
+
+/// Commands from the game thread to the audio thread. Clip bytes travel as an
+/// `Arc` once at registration; the hot commands are all plain data.
+pub enum AudioCommand {
+    RegisterClip {
+        clip: AudioClipId,
+        bytes: Arc<Vec<u8>>,
+    },
+    Play {
+        voice: VoiceId,
+        clip: AudioClipId,
+        params: VoiceParams,
+    },
+    Stop(VoiceId),
+    SetVolume(VoiceId, f32),
+    SetPosition(VoiceId, Vec3),
+    SetListener {
+        position: Vec3,
+    },
+    SetMasterVolume(f32),
+}
+
+/// Events back from the audio thread.
+pub enum AudioEvent {
+    /// One-shot voice drained its sink; the slot can be recycled.
+    VoiceFinished(VoiceId),
+}
+
+// =============================================================================
+// Audio thread
+// =============================================================================
+
+/// Mixed-voice budget: only this many voices own a live sink at once.
+const DEFAULT_MAX_REAL_VOICES: usize = 32;
+/// Command/event ring capacity. 200+ events per second with a 2 ms tick
+/// means well under 16 in flight; 1024 absorbs the worst burst.
+const COMMAND_QUEUE_CAPACITY: usize = 1024;
+/// Audio thread tick. Commands are drained and virtualization re-ranked at
+/// this cadence.
+const AUDIO_TICK: Duration = Duration::from_millis(2);
+
+struct ThreadVoice {
+    generation: u16,
+    clip: AudioClipId,
+    params: VoiceParams,
+    sink: Option<rodio::Sink>,
+    /// Voice survives ranking but is currently paused.
+    virtualized: bool,
+    active: bool,
+}
+
+impl ThreadVoice {
+    fn empty() -> Self {
+        Self {
+            generation: 0,
+            clip: AudioClipId(0),
+            params: VoiceParams::default(),
+            sink: None,
+            virtualized: false,
+            active: false,
+        }
+    }
+}
+
+/// Attenuated volume a voice contributes at the listener — the ranking key
+/// for virtualization (and a reasonable audio-importance value).
+pub fn audible_volume(params: &VoiceParams, listener: Vec3) -> f32 {
+    if !params.spatial {
+        return params.volume;
+    }
+    let distance = (params.position - listener).length();
+    if distance <= params.min_distance {
+        params.volume
+    } else if distance >= params.max_distance {
+        0.0
+    } else {
+        let range = params.max_distance - params.min_distance;
+        params.volume * (1.0 - (distance - params.min_distance) / range)
+    }
+}
+
+/// Rank voice indices by audible volume, loudest first. Returns the indices
+/// that should stay real; everything after `max_real` virtualizes.
+pub fn rank_voices(volumes: &[(usize, f32)], max_real: usize) -> Vec<usize> {
+    let mut sorted: Vec<(usize, f32)> = volumes.to_vec();
+    sorted.sort_by(|a, b| b.1.partial_cmp(&a.1).unwrap_or(std::cmp::Ordering::Equal));
+    sorted.into_iter().take(max_real).map(|(i, _)| i).collect()
+}
+
+fn audio_thread_main(
+    commands: SpscConsumer<AudioCommand>,
+    events: SpscProducer<AudioEvent>,
+    shutdown: Arc<AtomicBool>,
+    max_voices: usize,
+    max_real_voices: usize,
+) {
+    // rodio lives entirely on this thread; silent mode still drains commands
+    // so the game thread never backs up.
+    let stream = match rodio::OutputStream::try_default() {
+        Ok((s, h)) => {
+            log::info!("🔊 REACTOR Audio: realtime thread started");
+            Some((s, h))
+        }
+        Err(e) => {
+            log::warn!("🔇 REACTOR Audio: realtime thread in silent mode ({e})");
+            None
+        }
+    };
+
+    let mut clips: HashMap<AudioClipId, Arc<Vec<u8>>> = HashMap::new();
+    let mut voices: Vec<ThreadVoice> = (0..max_voices).map(|_| ThreadVoice::empty()).collect();
+    let mut listener = Vec3::ZERO;
+    let mut master_volume = 1.0f32;
+    // Scratch for the ranking pass, reused across ticks.
+    let mut ranking: Vec<(usize, f32)> = Vec::with_capacity(max_voices);
+
+    while !shutdown.load(Ordering::Acquire) {
+        // ── Drain commands ──
+        while let Some(command) = commands.pop() {
+            match command {
+                AudioCommand::RegisterClip { clip, bytes } => {
+                    clips.insert(clip, bytes);
+                }
+                AudioCommand::Play { voice, clip, params } => {
+                    let slot = &mut voices[voice.index as usize];
+                    slot.generation = voice.generation;
+                    slot.clip = clip;
+                    slot.params = params;
+                    slot.virtualized = false;
+                    slot.active = true;
+
+                    slot.sink = None;
+                    if let (Some((_, handle)), Some(bytes)) = (&stream, clips.get(&clip)) {
+                        if let Ok(sink) = rodio::Sink::try_new(handle) {
+                            let cursor = Cursor::new(bytes.as_ref().clone());
+                            match rodio::Decoder::new(cursor) {
+                                Ok(decoded) => {
+                                    if params.looping {
+                                        use rodio::Source;
+                                        sink.append(decoded.repeat_infinite());
+                                    } else {
+                                        sink.append(decoded);
+                                    }
+                                    sink.set_speed(params.pitch);
+                                    sink.set_volume(
+                                        audible_volume(&params, listener) * master_volume,
+                                    );
+                                    slot.sink = Some(sink);
+                                }
+                                Err(e) => log::warn!("Failed to decode audio clip: {e}"),
+                            }
+                        }
+                    }
+                }
+                AudioCommand::Stop(voice) => {
+                    let slot = &mut voices[voice.index as usize];
+                    if slot.generation == voice.generation && slot.active {
+                        if let Some(sink) = slot.sink.take() {
+                            sink.stop();
+                        }
+                        slot.active = false;
+                        let _ = events.push(AudioEvent::VoiceFinished(voice));
+                    }
+                }
+                AudioCommand::SetVolume(voice, volume) => {
+                    let slot = &mut voices[voice.index as usize];
+                    if slot.generation == voice.generation {
+                        slot.params.volume = volume;
+                    }
+                }
+                AudioCommand::SetPosition(voice, position) => {
+                    let slot = &mut voices[voice.index as usize];
+                    if slot.generation == voice.generation {
+                        slot.params.position = position;
+                    }
+                }
+                AudioCommand::SetListener { position } => listener = position,
+                AudioCommand::SetMasterVolume(volume) => master_volume = volume.clamp(0.0, 1.0),
+            }
+        }
+
+        // ── Reap finished one-shots ──
+        for (index, slot) in voices.iter_mut().enumerate() {
+            if !slot.active {
+                continue;
+            }
+            let finished = slot
+                .sink
+                .as_ref()
+                .map(|s| s.empty() && !slot.virtualized)
+                .unwrap_or(true);
+            if finished {
+                slot.sink = None;
+                slot.active = false;
+                let _ = events.push(AudioEvent::VoiceFinished(VoiceId {
+                    index: index as u16,
+                    generation: slot.generation,
+                }));
+            }
+        }
+
+        // ── Virtualization: rank by audible volume, keep the top N real ──
+        ranking.clear();
+        for (index, slot) in voices.iter().enumerate() {
+            if slot.active {
+                ranking.push((index, audible_volume(&slot.params, listener)));
+            }
+        }
+        if ranking.len() > max_real_voices {
+            let real = rank_voices(&ranking, max_real_voices);
+            let mut keep = vec![false; voices.len()];
+            for index in real {
+                keep[index] = true;
+            }
+            for (index, slot) in voices.iter_mut().enumerate() {
+                let Some(sink) = slot.sink.as_ref() else { continue };
+                if keep[index] && slot.virtualized {
+                    sink.play();
+                    slot.virtualized = false;
+                } else if !keep[index] && !slot.virtualized {
+                    sink.pause();
+                    slot.virtualized = true;
+                }
+            }
+        } else {
+            for slot in voices.iter_mut() {
+                if slot.virtualized {
+                    if let Some(sink) = slot.sink.as_ref() {
+                        sink.play();
+                    }
+                    slot.virtualized = false;
+                }
+            }
+        }
+
+        // ── Apply listener-relative volume to the real voices ──
+        for slot in voices.iter() {
+            if let Some(sink) = slot.sink.as_ref() {
+                if !slot.virtualized {
+                    sink.set_volume(audible_volume(&slot.params, listener) * master_volume);
+                }
+            }
+        }
+
+        std::thread::sleep(AUDIO_TICK);
+    }
+}
+
+// =============================================================================
+// Game-thread handle
+// =============================================================================
+
+/// Game-side mirror of an active voice, kept so importance maps and debug
+/// overlays never have to query the audio thread.
+#[derive(Clone, Copy, Debug)]
+pub struct VoiceMirror {
+    pub position: Vec3,
+    pub volume: f32,
+    pub spatial: bool,
+}
+
+/// Real-time-safe audio front end.
+///
+/// All methods are non-blocking: they allocate a voice from the pool, push a
+/// command into the SPSC ring and return. The audio thread owns rodio. When
+/// the ring is full the command is dropped and counted — never stalled.
+pub struct RealtimeAudio {
+    producer: SpscProducer<AudioCommand>,
+    events: SpscConsumer<AudioEvent>,
+    shutdown: Arc<AtomicBool>,
+    thread: Option<std::thread::JoinHandle<()>>,
+    /// Free slot indices (game side of the pool — no allocation on play).
+    free_voices: Vec<u16>,
+    generations: Vec<u16>,
+    mirrors: Vec<Option<VoiceMirror>>,
+    next_clip_id: u32,
+    dropped_commands: u32,
+}
+
+impl RealtimeAudio {
+    pub fn new() -> Self {
+        Self::with_limits(64, DEFAULT_MAX_REAL_VOICES)
+    }
+
+    /// `max_voices` is the pool size (hard cap on concurrent sounds);
+    /// `max_real_voices` is how many stay mixed after virtualization.
+    pub fn with_limits(max_voices: usize, max_real_voices: usize) -> Self {
+        let (producer, commands) = spsc_channel(COMMAND_QUEUE_CAPACITY);
+        let (event_producer, events) = spsc_channel(COMMAND_QUEUE_CAPACITY);
+        let shutdown = Arc::new(AtomicBool::new(false));
+
+        let thread_shutdown = shutdown.clone();
+        let thread = std::thread::Builder::new()
+            .name("reactor-audio".to_string())
+            .spawn(move || {
+                audio_thread_main(
+                    commands,
+                    event_producer,
+                    thread_shutdown,
+                    max_voices,
+                    max_real_voices,
+                )
+            })
+            .ok();
+
+        Self {
+            producer,
+            events,
+            shutdown,
+            thread,
+            free_voices: (0..max_voices as u16).rev().collect(),
+            generations: vec![0; max_voices],
+            mirrors: vec![None; max_voices],
+            next_clip_id: 1,
+            dropped_commands: 0,
+        }
+    }
+
+    /// Register a clip's encoded bytes. The `Arc` crosses to the audio thread
+    /// once; later plays reference it by id.
+    pub fn register_clip(&mut self, bytes: Arc<Vec<u8>>) -> AudioClipId {
+        let clip = AudioClipId(self.next_clip_id);
+        self.next_clip_id += 1;
+        self.send(AudioCommand::RegisterClip { clip, bytes });
+        clip
+    }
+
+    /// Start a voice from the pool. Returns `None` when the pool is
+    /// exhausted (the sound is dropped, not blocked on).
+    pub fn play(&mut self, clip: AudioClipId, params: VoiceParams) -> Option<VoiceId> {
+        let index = self.free_voices.pop()?;
+        let voice = VoiceId {
+            index,
+            generation: self.generations[index as usize],
+        };
+        self.mirrors[index as usize] = Some(VoiceMirror {
+            position: params.position,
+            volume: params.volume,
+            spatial: params.spatial,
+        });
+        self.send(AudioCommand::Play { voice, clip, params });
+        Some(voice)
+    }
+
+    pub fn stop(&mut self, voice: VoiceId) {
+        self.send(AudioCommand::Stop(voice));
+    }
+
+    pub fn set_volume(&mut self, voice: VoiceId, volume: f32) {
+        if let Some(mirror) = self.mirror_mut(voice) {
+            mirror.volume = volume;
+        }
+        self.send(AudioCommand::SetVolume(voice, volume));
+    }
+
+    pub fn set_position(&mut self, voice: VoiceId, position: Vec3) {
+        if let Some(mirror) = self.mirror_mut(voice) {
+            mirror.position = position;
+        }
+        self.send(AudioCommand::SetPosition(voice, position));
+    }
+
+    pub fn set_listener(&mut self, position: Vec3) {
+        self.send(AudioCommand::SetListener { position });
+    }
+
+    pub fn set_master_volume(&mut self, volume: f32) {
+        self.send(AudioCommand::SetMasterVolume(volume));
+    }
+
+    /// Drain voice-finished events and recycle their slots. Call once per
+    /// frame.
+    pub fn update(&mut self) {
+        while let Some(event) = self.events.pop() {
+            match event {
+                AudioEvent::VoiceFinished(voice) => {
+                    let index = voice.index as usize;
+                    if self.generations[index] == voice.generation {
+                        self.generations[index] = self.generations[index].wrapping_add(1);
+                        self.mirrors[index] = None;
+                        self.free_voices.push(voice.index);
+                    }
+                }
+            }
+        }
+    }
+
+    /// Active spatial voices as `(position, volume)` — feed these to
+    /// `ImportanceMap::set_audio_importance` for audio-driven scheduling.
+    pub fn active_voices(&self) -> impl Iterator<Item = (Vec3, f32)> + '_ {
+        self.mirrors
+            .iter()
+            .flatten()
+            .filter(|m| m.spatial)
+            .map(|m| (m.position, m.volume))
+    }
+
+    pub fn active_voice_count(&self) -> usize {
+        self.mirrors.iter().flatten().count()
+    }
+
+    /// Commands dropped because the ring was full (should stay 0).
+    pub fn dropped_commands(&self) -> u32 {
+        self.dropped_commands
+    }
+
+    fn mirror_mut(&mut self, voice: VoiceId) -> Option<&mut VoiceMirror> {
+        if self.generations[voice.index as usize] != voice.generation {
+            return None;
+        }
+        self.mirrors[voice.index as usize].as_mut()
+    }
+
+    fn send(&mut self, command: AudioCommand) {
+        if self.producer.push(command).is_err() {
+            self.dropped_commands += 1;
+        }
+    }
+}
+
+impl Default for RealtimeAudio {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl Drop for RealtimeAudio {
+    fn drop(&mut self) {
+        self.shutdown.store(true, Ordering::Release);
+        if let Some(thread) = self.thread.take() {
+            let _ = thread.join();
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn spsc_ring_is_fifo_across_threads() {
+        let (producer, consumer) = spsc_channel::<u32>(256);
+
+        let writer = std::thread::spawn(move || {
+            for i in 0..10_000u32 {
+                let mut value = i;
+                loop {
+                    match producer.push(value) {
+                        Ok(()) => break,
+                        Err(v) => {
+                            value = v;
+                            std::thread::yield_now();
+                        }
+                    }
+                }
+            }
+        });
+
+        let mut expected = 0u32;
+        while expected < 10_000 {
+            if let Some(value) = consumer.pop() {
+                assert_eq!(value, expected);
+                expected += 1;
+            } else {
+                std::thread::yield_now();
+            }
+        }
+        writer.join().unwrap();
+    }
+
+    #[test]
+    fn spsc_push_fails_when_full_instead_of_blocking() {
+        let (producer, consumer) = spsc_channel::<u32>(4);
+        for i in 0..4 {
+            assert!(producer.push(i).is_ok());
+        }
+        assert_eq!(producer.push(99), Err(99));
+        assert_eq!(consumer.pop(), Some(0));
+        assert!(producer.push(99).is_ok());
+    }
+
+    #[test]
+    fn ranking_keeps_the_loudest_voices() {
+        let listener = Vec3::ZERO;
+        let near = VoiceParams {
+            position: Vec3::new(2.0, 0.0, 0.0),
+            ..Default::default()
+        };
+        let far = VoiceParams {
+            position: Vec3::new(90.0, 0.0, 0.0),
+            ..Default::default()
+        };
+        let out_of_range = VoiceParams {
+            position: Vec3::new(500.0, 0.0, 0.0),
+            ..Default::default()
+        };
+
+        assert!(audible_volume(&near, listener) > audible_volume(&far, listener));
+        assert_eq!(audible_volume(&out_of_range, listener), 0.0);
+
+        let volumes = vec![
+            (0, audible_volume(&far, listener)),
+            (1, audible_volume(&near, listener)),
+            (2, audible_volume(&out_of_range, listener)),
+        ];
+        assert_eq!(rank_voices(&volumes, 2), vec![1, 0]);
+    }
+
+    #[test]
+    fn voice_pool_recycles_without_allocation() {
+        let mut audio = RealtimeAudio::with_limits(2, 2);
+        let clip = audio.register_clip(Arc::new(Vec::new()));
+
+        let a = audio.play(clip, VoiceParams::default()).unwrap();
+        let b = audio.play(clip, VoiceParams::default()).unwrap();
+        assert_ne!(a.index, b.index);
+        // Pool exhausted: play drops instead of allocating.
+        assert!(audio.play(clip, VoiceParams::default()).is_none());
+
+        // Empty clips finish immediately; the audio thread reports back and
+        // the slots recycle with a bumped generation.
+        let deadline = std::time::Instant::now() + Duration::from_secs(2);
+        loop {
+            audio.update();
+            if audio.active_voice_count() == 0 {
+                break;
+            }
+            assert!(std::time::Instant::now() < deadline, "voices never recycled");
+            std::thread::sleep(Duration::from_millis(5));
+        }
+
+        let c = audio.play(clip, VoiceParams::default()).unwrap();
+        assert_eq!(c.generation, 1);
+    }
+}
@@ -7,10 +7,14 @@
 // =============================================================================
 
 use std::any::{Any, TypeId};
+use std::cell::Cell;
 use std::collections::HashMap;
+use std::marker::PhantomData;
 use std::sync::{Arc, Mutex};
 use tokio::sync::mpsc::{unbounded_channel, UnboundedReceiver, UnboundedSender};
 
+use crate::core::linear_allocator::LinearAllocator;
+
 /// A thread-safe, generic event bus that distributes events to registered observers.
 #[derive(Clone)]
 pub struct EventBus {
@@ -91,3 +95,229 @@ impl<T> Observer<T> {
         self.rx.recv().await
     }
 }
+
+// =============================================================================
+// Frame-scoped event queues (zero-allocation fast path)
+// =============================================================================
+// The tokio path above is the right tool for cross-thread async consumers,
+// but gameplay code emitting ~10k collision/trigger events per frame doesn't
+// need channels or wakeups. `FrameEventBus` gives those systems a
+// frame-coherent alternative: per-type double-buffered queues backed by the
+// frame `LinearAllocator`, where `emit` is a bump-allocated write and readers
+// iterate last frame's events as a plain slice with zero copies.
+// =============================================================================
+
+/// Internal trait so the bus can flip every typed queue without knowing `T`.
+trait FrameQueueOps {
+    fn flip(&self);
+    fn as_any(&self) -> &dyn Any;
+}
+
+/// Double-buffered, frame-scoped queue for events of type `T`.
+///
+/// Events emitted during frame N become readable as a contiguous slice during
+/// frame N+1 and are discarded when the buffers flip again. `T: Copy` keeps
+/// the reset trivially correct (no destructors to run on discarded events).
+///
+/// Single-threaded by design, like the `LinearAllocator` underneath; emit
+/// from the main/gameplay thread and use the tokio [`EventBus`] for anything
+/// that crosses threads.
+pub struct FrameEventQueue<T: Copy> {
+    buffers: [LinearAllocator; 2],
+    starts: [Cell<*const T>; 2],
+    counts: [Cell<usize>; 2],
+    /// Index of the buffer currently being written.
+    write: Cell<usize>,
+    dropped: Cell<usize>,
+    _marker: PhantomData<T>,
+}
+
+impl<T: Copy + 'static> FrameEventQueue<T> {
+    /// Create a queue holding up to `capacity` events per frame.
+    pub fn new(capacity: usize) -> Self {
+        let bytes = capacity.max(1) * std::mem::size_of::<T>().max(1)
+            + std::mem::align_of::<T>();
+        Self {
+            buffers: [LinearAllocator::new(bytes), LinearAllocator::new(bytes)],
+            starts: [Cell::new(std::ptr::null()), Cell::new(std::ptr::null())],
+            counts: [Cell::new(0), Cell::new(0)],
+            write: Cell::new(0),
+            dropped: Cell::new(0),
+            _marker: PhantomData,
+        }
+    }
+
+    /// Emit an event into the current frame's buffer.
+    ///
+    /// Returns `false` (and counts the drop) if the buffer is full; the
+    /// allocator already logs the exhaustion.
+    #[inline]
+    pub fn emit(&self, event: T) -> bool {
+        let w = self.write.get();
+        let Some(ptr) = self.buffers[w].allocate(std::mem::size_of::<T>(), std::mem::align_of::<T>())
+        else {
+            self.dropped.set(self.dropped.get() + 1);
+            return false;
+        };
+        let typed = ptr.as_ptr() as *mut T;
+        // SAFETY: the allocator returned an in-bounds, aligned region of
+        // size_of::<T>() bytes that nothing else references.
+        unsafe { typed.write(event) };
+        if self.counts[w].get() == 0 {
+            self.starts[w].set(typed);
+        }
+        self.counts[w].set(self.counts[w].get() + 1);
+        true
+    }
+
+    /// Events emitted during the previous frame, as one contiguous slice.
+    #[inline]
+    pub fn events(&self) -> &[T] {
+        let r = 1 - self.write.get();
+        let count = self.counts[r].get();
+        if count == 0 {
+            return &[];
+        }
+        // SAFETY: all allocations in a buffer are the same type, and size is
+        // always a multiple of alignment in Rust, so consecutive bump
+        // allocations are contiguous. The slice borrows `&self`, and `flip`
+        // (which invalidates it) takes `&mut self` on the owning bus.
+        unsafe { std::slice::from_raw_parts(self.starts[r].get(), count) }
+    }
+
+    /// Events dropped because a frame overflowed the buffer.
+    pub fn dropped(&self) -> usize {
+        self.dropped.get()
+    }
+}
+
+impl<T: Copy + 'static> FrameQueueOps for FrameEventQueue<T> {
+    fn flip(&self) {
+        let next = 1 - self.write.get();
+        self.buffers[next].reset();
+        self.counts[next].set(0);
+        self.starts[next].set(std::ptr::null());
+        self.write.set(next);
+    }
+
+    fn as_any(&self) -> &dyn Any {
+        self
+    }
+}
+
+/// Registry of per-type [`FrameEventQueue`]s with a single per-frame flip.
+///
+/// Typical frame:
+/// ```ignore
+/// frame_events.begin_frame();                  // last frame becomes readable
+/// frame_events.emit(CollisionEvent { .. });    // bump-allocated write
+/// for hit in frame_events.events::<CollisionEvent>() { /* zero copies */ }
+/// ```
+pub struct FrameEventBus {
+    queues: HashMap<TypeId, Box<dyn FrameQueueOps>>,
+    default_capacity: usize,
+}
+
+impl FrameEventBus {
+    /// `default_capacity` is the per-frame event budget used when a type is
+    /// first seen; use [`FrameEventBus::channel_with_capacity`] to size hot
+    /// types explicitly.
+    pub fn new(default_capacity: usize) -> Self {
+        Self {
+            queues: HashMap::new(),
+            default_capacity,
+        }
+    }
+
+    /// Register (or fetch) the queue for `T` with an explicit capacity.
+    /// Capacity is only applied on first registration.
+    pub fn channel_with_capacity<T: Copy + 'static>(&mut self, capacity: usize) -> &FrameEventQueue<T> {
+        self.queues
+            .entry(TypeId::of::<T>())
+            .or_insert_with(|| Box::new(FrameEventQueue::<T>::new(capacity)))
+            .as_any()
+            .downcast_ref()
+            .expect("FrameEventBus: queue type mismatch")
+    }
+
+    /// Emit an event, creating the queue with the default capacity on first use.
+    #[inline]
+    pub fn emit<T: Copy + 'static>(&mut self, event: T) -> bool {
+        let capacity = self.default_capacity;
+        self.channel_with_capacity::<T>(capacity).emit(event)
+    }
+
+    /// Last frame's events of type `T`. Empty if the type was never emitted.
+    #[inline]
+    pub fn events<T: Copy + 'static>(&self) -> &[T] {
+        self.queues
+            .get(&TypeId::of::<T>())
+            .and_then(|q| q.as_any().downcast_ref::<FrameEventQueue<T>>())
+            .map(|q| q.events())
+            .unwrap_or(&[])
+    }
+
+    /// Flip every queue: last frame's events become readable, the buffer from
+    /// two frames ago is reset for writing. Call once at the top of the frame.
+    /// Taking `&mut self` invalidates any outstanding `events()` slices.
+    pub fn begin_frame(&mut self) {
+        for queue in self.queues.values() {
+            queue.flip();
+        }
+    }
+}
+
+impl Default for FrameEventBus {
+    fn default() -> Self {
+        Self::new(16 * 1024)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[derive(Clone, Copy, Debug, PartialEq)]
+    struct Collision {
+        a: u32,
+        b: u32,
+    }
+
+    #[test]
+    fn events_become_readable_after_flip() {
+        let mut bus = FrameEventBus::new(64);
+        bus.emit(Collision { a: 1, b: 2 });
+        bus.emit(Collision { a: 3, b: 4 });
+        // Still frame N: nothing readable yet.
+        assert!(bus.events::<Collision>().is_empty());
+
+        bus.begin_frame();
+        let events = bus.events::<Collision>();
+        assert_eq!(events, &[Collision { a: 1, b: 2 }, Collision { a: 3, b: 4 }]);
+
+        // Two flips later the original events are gone.
+        bus.begin_frame();
+        assert!(bus.events::<Collision>().is_empty());
+    }
+
+    #[test]
+    fn reading_last_frame_while_emitting_this_frame() {
+        let mut bus = FrameEventBus::new(64);
+        bus.emit(Collision { a: 1, b: 1 });
+        bus.begin_frame();
+        bus.emit(Collision { a: 2, b: 2 });
+        // Last frame's event is still intact while frame N+1 writes.
+        assert_eq!(bus.events::<Collision>(), &[Collision { a: 1, b: 1 }]);
+        bus.begin_frame();
+        assert_eq!(bus.events::<Collision>(), &[Collision { a: 2, b: 2 }]);
+    }
+
+    #[test]
+    fn overflow_drops_instead_of_allocating() {
+        let queue = FrameEventQueue::<Collision>::new(2);
+        assert!(queue.emit(Collision { a: 0, b: 0 }));
+        assert!(queue.emit(Collision { a: 1, b: 1 }));
+        assert!(!queue.emit(Collision { a: 2, b: 2 }));
+        assert_eq!(queue.dropped(), 1);
+    }
+}
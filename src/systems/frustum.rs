@@ -194,6 +194,180 @@ pub enum FrustumTestResult {
     Inside,
 }
 
+// =============================================================================
+// Batch culling (SoA, 8 boxes per iteration)
+// =============================================================================
+
+/// Lanes processed per batch-cull iteration. Eight f32 lanes = one AVX
+/// register; the plain-array inner loop below autovectorizes on stable Rust.
+const CULL_LANES: usize = 8;
+
+/// Structure-of-arrays AABB storage for batch culling.
+///
+/// Boxes are stored as center + half-extent so the per-plane test reduces to
+/// `n·c + |n|·e + d >= 0` — no per-lane min/max selection, just multiply-adds
+/// over contiguous arrays.
+#[derive(Default)]
+pub struct AabbSoA {
+    cx: Vec<f32>,
+    cy: Vec<f32>,
+    cz: Vec<f32>,
+    ex: Vec<f32>,
+    ey: Vec<f32>,
+    ez: Vec<f32>,
+}
+
+impl AabbSoA {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    pub fn with_capacity(capacity: usize) -> Self {
+        Self {
+            cx: Vec::with_capacity(capacity),
+            cy: Vec::with_capacity(capacity),
+            cz: Vec::with_capacity(capacity),
+            ex: Vec::with_capacity(capacity),
+            ey: Vec::with_capacity(capacity),
+            ez: Vec::with_capacity(capacity),
+        }
+    }
+
+    pub fn clear(&mut self) {
+        self.cx.clear();
+        self.cy.clear();
+        self.cz.clear();
+        self.ex.clear();
+        self.ey.clear();
+        self.ez.clear();
+    }
+
+    pub fn push(&mut self, aabb: &AABB) {
+        let center = (aabb.min + aabb.max) * 0.5;
+        let extent = (aabb.max - aabb.min) * 0.5;
+        self.cx.push(center.x);
+        self.cy.push(center.y);
+        self.cz.push(center.z);
+        self.ex.push(extent.x);
+        self.ey.push(extent.y);
+        self.ez.push(extent.z);
+    }
+
+    pub fn len(&self) -> usize {
+        self.cx.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.cx.is_empty()
+    }
+}
+
+/// Per-box visibility results from a batch cull, one bit per box.
+#[derive(Default)]
+pub struct CullBits {
+    words: Vec<u64>,
+    len: usize,
+}
+
+impl CullBits {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Resize for `len` boxes with all bits cleared (= not visible).
+    pub fn reset(&mut self, len: usize) {
+        self.len = len;
+        self.words.clear();
+        self.words.resize((len + 63) / 64, 0);
+    }
+
+    #[inline]
+    fn set(&mut self, index: usize) {
+        self.words[index / 64] |= 1u64 << (index % 64);
+    }
+
+    #[inline]
+    pub fn is_visible(&self, index: usize) -> bool {
+        index < self.len && (self.words[index / 64] >> (index % 64)) & 1 != 0
+    }
+
+    pub fn len(&self) -> usize {
+        self.len
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len == 0
+    }
+
+    pub fn count_visible(&self) -> usize {
+        self.words.iter().map(|w| w.count_ones() as usize).sum()
+    }
+
+    /// Iterate the indices of all visible boxes.
+    pub fn iter_visible(&self) -> impl Iterator<Item = usize> + '_ {
+        (0..self.len).filter(move |&i| self.is_visible(i))
+    }
+}
+
+impl Frustum {
+    /// Batch-test every box in `aabbs`, writing one visibility bit per box.
+    ///
+    /// Planes are pre-swizzled into SoA form (`n`, `|n|`, `d` per plane) and
+    /// boxes are consumed eight at a time, so the inner loop is a pure
+    /// multiply-add chain over contiguous arrays — the compiler turns it into
+    /// wide SIMD on every target we ship. Equivalent to calling
+    /// [`Frustum::intersects_aabb`] per box, at a fraction of the cost.
+    pub fn cull_aabbs(&self, aabbs: &AabbSoA, out: &mut CullBits) {
+        out.reset(aabbs.len());
+
+        // SoA planes: normal, |normal| (for the extent projection), distance.
+        let mut nx = [0.0f32; 6];
+        let mut ny = [0.0f32; 6];
+        let mut nz = [0.0f32; 6];
+        let mut ax = [0.0f32; 6];
+        let mut ay = [0.0f32; 6];
+        let mut az = [0.0f32; 6];
+        let mut pd = [0.0f32; 6];
+        for (i, plane) in self.planes.iter().enumerate() {
+            nx[i] = plane.normal.x;
+            ny[i] = plane.normal.y;
+            nz[i] = plane.normal.z;
+            ax[i] = plane.normal.x.abs();
+            ay[i] = plane.normal.y.abs();
+            az[i] = plane.normal.z.abs();
+            pd[i] = plane.distance;
+        }
+
+        let n = aabbs.len();
+        let mut base = 0;
+        while base < n {
+            let lanes = CULL_LANES.min(n - base);
+            let mut inside = [true; CULL_LANES];
+            for p in 0..6 {
+                for lane in 0..lanes {
+                    let i = base + lane;
+                    // Distance from plane to the positive vertex:
+                    // n·c + |n|·e + d. Negative ⇒ fully outside this plane.
+                    let dist = nx[p] * aabbs.cx[i]
+                        + ny[p] * aabbs.cy[i]
+                        + nz[p] * aabbs.cz[i]
+                        + ax[p] * aabbs.ex[i]
+                        + ay[p] * aabbs.ey[i]
+                        + az[p] * aabbs.ez[i]
+                        + pd[p];
+                    inside[lane] &= dist >= 0.0;
+                }
+            }
+            for lane in 0..lanes {
+                if inside[lane] {
+                    out.set(base + lane);
+                }
+            }
+            base += lanes;
+        }
+    }
+}
+
 /// Culling system that tracks visible objects
 pub struct CullingSystem {
     frustum: Frustum,
@@ -225,6 +399,14 @@ impl CullingSystem {
         visible
     }
 
+    /// Batch-cull a whole frame's worth of AABBs in one call, updating the
+    /// visible/total counters. Results land in `out`, one bit per box.
+    pub fn cull_all(&mut self, aabbs: &AabbSoA, out: &mut CullBits) {
+        self.frustum.cull_aabbs(aabbs, out);
+        self.total_count += aabbs.len();
+        self.visible_count += out.count_visible();
+    }
+
     pub fn is_visible_sphere(&mut self, sphere: &Sphere) -> bool {
         self.total_count += 1;
         let visible = self.frustum.intersects_sphere(sphere);
@@ -260,3 +442,71 @@ impl Default for CullingSystem {
         Self::new()
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn test_frustum() -> Frustum {
+        let view = Mat4::look_at_rh(Vec3::new(0.0, 0.0, 10.0), Vec3::ZERO, Vec3::Y);
+        let proj = Mat4::perspective_rh(60f32.to_radians(), 16.0 / 9.0, 0.1, 100.0);
+        Frustum::from_view_projection(proj * view)
+    }
+
+    #[test]
+    fn test_cull_aabbs_matches_scalar_path() {
+        let frustum = test_frustum();
+
+        let mut boxes = Vec::new();
+        // Grid of unit boxes spanning well past the frustum on every axis.
+        for x in -20..=20 {
+            for y in -12..=12 {
+                for z in -30..=15 {
+                    let center = Vec3::new(x as f32 * 3.0, y as f32 * 3.0, z as f32 * 3.0);
+                    boxes.push(AABB::new(center - Vec3::splat(0.5), center + Vec3::splat(0.5)));
+                }
+            }
+        }
+
+        let mut soa = AabbSoA::with_capacity(boxes.len());
+        for aabb in &boxes {
+            soa.push(aabb);
+        }
+
+        let mut bits = CullBits::new();
+        frustum.cull_aabbs(&soa, &mut bits);
+
+        assert_eq!(bits.len(), boxes.len());
+        for (i, aabb) in boxes.iter().enumerate() {
+            assert_eq!(
+                bits.is_visible(i),
+                frustum.intersects_aabb(aabb),
+                "batch/scalar mismatch at box {}",
+                i
+            );
+        }
+        // Sanity: the grid extends past the frustum, so both outcomes occur.
+        assert!(bits.count_visible() > 0);
+        assert!(bits.count_visible() < boxes.len());
+    }
+
+    #[test]
+    fn test_cull_all_updates_counters() {
+        let mut culling = CullingSystem::new();
+        let view = Mat4::look_at_rh(Vec3::new(0.0, 0.0, 10.0), Vec3::ZERO, Vec3::Y);
+        let proj = Mat4::perspective_rh(60f32.to_radians(), 16.0 / 9.0, 0.1, 100.0);
+        culling.update_frustum(proj * view);
+
+        let mut soa = AabbSoA::new();
+        soa.push(&AABB::new(Vec3::splat(-1.0), Vec3::splat(1.0))); // at origin, visible
+        soa.push(&AABB::new(Vec3::splat(500.0), Vec3::splat(501.0))); // far outside
+
+        let mut bits = CullBits::new();
+        culling.cull_all(&soa, &mut bits);
+
+        assert_eq!(culling.total_count(), 2);
+        assert_eq!(culling.visible_count(), 1);
+        assert!(bits.is_visible(0));
+        assert!(!bits.is_visible(1));
+    }
+}
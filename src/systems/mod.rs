@@ -15,13 +15,17 @@ pub mod scene;
 
 // Re-exports for backward compatibility
 pub use animation::{
-    AnimationClip, AnimationPlayer, AnimationTrack, EasingFunction, Keyframe, LoopMode, Tween,
+    AnimationBatch, AnimationClip, AnimationPlayer, AnimationTrack, ClipCursor, EasingFunction,
+    Keyframe, LoopMode, TrackCursor, Tween,
+};
+pub use audio::{
+    AudioClipId, AudioListener, AudioSource, AudioSourceId, AudioSystem, RealtimeAudio, VoiceId,
+    VoiceParams,
 };
-pub use audio::{AudioClipId, AudioListener, AudioSource, AudioSourceId, AudioSystem};
 pub use console::{color, GameBanner, Log, ReactorBanner};
-pub use event_bus::{EventBus, Observer};
-pub use frustum::{CullingSystem, Frustum, FrustumTestResult, Plane};
+pub use event_bus::{EventBus, FrameEventBus, FrameEventQueue, Observer};
+pub use frustum::{AabbSoA, CullBits, CullingSystem, Frustum, FrustumTestResult, Plane};
 pub use lighting::{Light, LightType, LightingSystem};
 pub use particles::{EmitterShape, Particle, ParticleSystem, ParticleSystemConfig};
-pub use physics::{PhysicsWorld, Ray, RigidBody, Sphere, AABB};
+pub use physics::{Broadphase, BroadphaseHandle, PhysicsWorld, Ray, RigidBody, Sphere, AABB};
 pub use scene::{Scene, SceneObject};
@@ -218,12 +218,116 @@ impl Default for ParticleSystemConfig {
     }
 }
 
+/// Structure-of-arrays particle storage.
+///
+/// Each field lives in its own packed array so the integration loops stream
+/// one attribute at a time (position doesn't drag velocity/color/lifetime
+/// through the cache like the old `Vec<Particle>` layout did). There is no
+/// `alive` flag: expired particles are swap-removed, so every stored index
+/// is live and `len()` is the live count.
+#[derive(Default)]
+struct ParticleStore {
+    pos_x: Vec<f32>,
+    pos_y: Vec<f32>,
+    pos_z: Vec<f32>,
+    vel_x: Vec<f32>,
+    vel_y: Vec<f32>,
+    vel_z: Vec<f32>,
+    acc_x: Vec<f32>,
+    acc_y: Vec<f32>,
+    acc_z: Vec<f32>,
+    size: Vec<f32>,
+    rotation: Vec<f32>,
+    angular_velocity: Vec<f32>,
+    lifetime: Vec<f32>,
+    max_lifetime: Vec<f32>,
+    color: Vec<Vec4>,
+}
+
+impl ParticleStore {
+    fn with_capacity(capacity: usize) -> Self {
+        Self {
+            pos_x: Vec::with_capacity(capacity),
+            pos_y: Vec::with_capacity(capacity),
+            pos_z: Vec::with_capacity(capacity),
+            vel_x: Vec::with_capacity(capacity),
+            vel_y: Vec::with_capacity(capacity),
+            vel_z: Vec::with_capacity(capacity),
+            acc_x: Vec::with_capacity(capacity),
+            acc_y: Vec::with_capacity(capacity),
+            acc_z: Vec::with_capacity(capacity),
+            size: Vec::with_capacity(capacity),
+            rotation: Vec::with_capacity(capacity),
+            angular_velocity: Vec::with_capacity(capacity),
+            lifetime: Vec::with_capacity(capacity),
+            max_lifetime: Vec::with_capacity(capacity),
+            color: Vec::with_capacity(capacity),
+        }
+    }
+
+    fn len(&self) -> usize {
+        self.pos_x.len()
+    }
+
+    fn push(&mut self, p: Particle) {
+        self.pos_x.push(p.position.x);
+        self.pos_y.push(p.position.y);
+        self.pos_z.push(p.position.z);
+        self.vel_x.push(p.velocity.x);
+        self.vel_y.push(p.velocity.y);
+        self.vel_z.push(p.velocity.z);
+        self.acc_x.push(p.acceleration.x);
+        self.acc_y.push(p.acceleration.y);
+        self.acc_z.push(p.acceleration.z);
+        self.size.push(p.size);
+        self.rotation.push(p.rotation);
+        self.angular_velocity.push(p.angular_velocity);
+        self.lifetime.push(p.lifetime);
+        self.max_lifetime.push(p.max_lifetime);
+        self.color.push(p.color);
+    }
+
+    fn swap_remove(&mut self, index: usize) {
+        self.pos_x.swap_remove(index);
+        self.pos_y.swap_remove(index);
+        self.pos_z.swap_remove(index);
+        self.vel_x.swap_remove(index);
+        self.vel_y.swap_remove(index);
+        self.vel_z.swap_remove(index);
+        self.acc_x.swap_remove(index);
+        self.acc_y.swap_remove(index);
+        self.acc_z.swap_remove(index);
+        self.size.swap_remove(index);
+        self.rotation.swap_remove(index);
+        self.angular_velocity.swap_remove(index);
+        self.lifetime.swap_remove(index);
+        self.max_lifetime.swap_remove(index);
+        self.color.swap_remove(index);
+    }
+
+    /// Materialize one particle (for iteration / debugging).
+    fn get(&self, i: usize) -> Particle {
+        Particle {
+            position: Vec3::new(self.pos_x[i], self.pos_y[i], self.pos_z[i]),
+            velocity: Vec3::new(self.vel_x[i], self.vel_y[i], self.vel_z[i]),
+            acceleration: Vec3::new(self.acc_x[i], self.acc_y[i], self.acc_z[i]),
+            color: self.color[i],
+            size: self.size[i],
+            rotation: self.rotation[i],
+            angular_velocity: self.angular_velocity[i],
+            lifetime: self.lifetime[i],
+            max_lifetime: self.max_lifetime[i],
+            alive: true,
+        }
+    }
+}
+
 /// Particle system
 pub struct ParticleSystem {
     pub config: ParticleSystemConfig,
     pub position: Vec3,
     pub rotation: glam::Quat,
-    particles: Vec<Particle>,
+    particles: ParticleStore,
     emission_accumulator: f32,
     time: f32,
     playing: bool,
@@ -236,7 +340,7 @@ impl ParticleSystem {
             config,
             position: Vec3::ZERO,
             rotation: glam::Quat::IDENTITY,
-            particles: Vec::with_capacity(max),
+            particles: ParticleStore::with_capacity(max),
             emission_accumulator: 0.0,
             time: 0.0,
             playing: true,
@@ -315,13 +419,9 @@ impl ParticleSystem {
     }
 
     fn emit_particle(&mut self) {
+        // Dead particles are swap-removed in update(), so the store only
+        // holds live ones — at capacity there is nothing to recycle.
         if self.particles.len() >= self.config.max_particles {
-            // Find dead particle to reuse
-            let dead_idx = self.particles.iter().position(|p| !p.alive);
-            if let Some(idx) = dead_idx {
-                self.init_particle_at(idx);
-                return;
-            }
             return;
         }
 
@@ -329,11 +429,6 @@ impl ParticleSystem {
         self.particles.push(particle);
     }
 
-    fn init_particle_at(&mut self, idx: usize) {
-        let particle = self.create_new_particle();
-        self.particles[idx] = particle;
-    }
-
     fn create_new_particle(&self) -> Particle {
         let mut particle = Particle {
             alive: true,
@@ -393,60 +488,99 @@ impl ParticleSystem {
     }
 
     pub fn update(&mut self, dt: f32) {
-        if !self.playing {
-            // Still update existing particles
-            for particle in &mut self.particles {
-                particle.update(dt);
+        if self.playing {
+            self.time += dt;
+
+            // Check duration
+            if !self.config.looping && self.time >= self.config.duration {
+                self.playing = false;
             }
-            return;
-        }
 
-        self.time += dt;
+            // Emit new particles
+            if self.config.emission_rate > 0.0 {
+                self.emission_accumulator += dt * self.config.emission_rate;
+                while self.emission_accumulator >= 1.0 {
+                    self.emission_accumulator -= 1.0;
+                    self.emit_particle();
+                }
+            }
 
-        // Check duration
-        if !self.config.looping && self.time >= self.config.duration {
-            self.playing = false;
+            // Initial burst
+            if self.time <= dt && self.config.burst_count > 0 {
+                self.burst(self.config.burst_count);
+            }
         }
 
-        // Emit new particles
-        if self.config.emission_rate > 0.0 {
-            self.emission_accumulator += dt * self.config.emission_rate;
-            while self.emission_accumulator >= 1.0 {
-                self.emission_accumulator -= 1.0;
-                self.emit_particle();
+        // ── Age + recycle dead particles (swap-remove keeps arrays packed) ──
+        let p = &mut self.particles;
+        let mut i = 0;
+        while i < p.len() {
+            p.lifetime[i] += dt;
+            if p.lifetime[i] >= p.max_lifetime[i] {
+                p.swap_remove(i);
+            } else {
+                i += 1;
             }
         }
 
-        // Initial burst
-        if self.time <= dt && self.config.burst_count > 0 {
-            self.burst(self.config.burst_count);
+        // ── Integration: one attribute stream at a time, autovectorized ──
+        for (v, a) in p.vel_x.iter_mut().zip(&p.acc_x) {
+            *v += a * dt;
+        }
+        for (v, a) in p.vel_y.iter_mut().zip(&p.acc_y) {
+            *v += a * dt;
+        }
+        for (v, a) in p.vel_z.iter_mut().zip(&p.acc_z) {
+            *v += a * dt;
+        }
+        for (pos, v) in p.pos_x.iter_mut().zip(&p.vel_x) {
+            *pos += v * dt;
+        }
+        for (pos, v) in p.pos_y.iter_mut().zip(&p.vel_y) {
+            *pos += v * dt;
+        }
+        for (pos, v) in p.pos_z.iter_mut().zip(&p.vel_z) {
+            *pos += v * dt;
+        }
+        for (r, w) in p.rotation.iter_mut().zip(&p.angular_velocity) {
+            *r += w * dt;
         }
 
-        // Update particles
-        for particle in &mut self.particles {
-            if !particle.alive {
-                continue;
+        // ── Color over lifetime ──
+        // Constant/Linear cover every preset and stay branch-free in the
+        // loop; Curve falls back to per-particle sampling.
+        match &self.config.color_over_lifetime {
+            ValueOverLifetime::Constant(c) => {
+                for color in p.color.iter_mut() {
+                    *color = *c;
+                }
+            }
+            ValueOverLifetime::Linear { start, end } => {
+                for ((color, &life), &max_life) in
+                    p.color.iter_mut().zip(&p.lifetime).zip(&p.max_lifetime)
+                {
+                    *color = start.lerp(*end, life / max_life);
+                }
+            }
+            curve @ ValueOverLifetime::Curve(_) => {
+                for ((color, &life), &max_life) in
+                    p.color.iter_mut().zip(&p.lifetime).zip(&p.max_lifetime)
+                {
+                    *color = curve.sample(life / max_life);
+                }
             }
-
-            particle.update(dt);
-
-            // Apply over-lifetime modifiers
-            let age = particle.age();
-            let _size_mult = self.config.size_over_lifetime.sample(age);
-            let color = self.config.color_over_lifetime.sample(age);
-
-            particle.color = color;
-            // Size is base size * multiplier
-            // (stored size is the base, we'd apply multiplier at render time)
         }
+        // Size over lifetime stays a render-time multiplier on the stored
+        // base size, same as before the SoA rewrite.
     }
 
     pub fn alive_count(&self) -> usize {
-        self.particles.iter().filter(|p| p.alive).count()
+        self.particles.len()
     }
 
-    pub fn particles(&self) -> impl Iterator<Item = &Particle> {
-        self.particles.iter().filter(|p| p.alive)
+    /// Iterate live particles as materialized `Particle` values.
+    pub fn particles(&self) -> impl Iterator<Item = Particle> + '_ {
+        (0..self.particles.len()).map(move |i| self.particles.get(i))
     }
 
     pub fn is_finished(&self) -> bool {
@@ -473,3 +607,56 @@ fn random_unit_sphere() -> Vec3 {
     let phi = (t * 0.0001 % 1.0) * std::f32::consts::PI;
     Vec3::new(phi.sin() * theta.cos(), phi.cos(), phi.sin() * theta.sin())
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_burst_emits_and_integrates() {
+        let mut system = ParticleSystem::new(ParticleSystemConfig {
+            emission_rate: 0.0,
+            lifetime: RandomRange::constant(10.0),
+            start_speed: RandomRange::constant(0.0),
+            gravity_modifier: 1.0, // acceleration (0, -9.81, 0)
+            ..Default::default()
+        });
+        system.burst(100);
+        assert_eq!(system.alive_count(), 100);
+
+        system.update(0.5);
+        // v = -9.81 * 0.5, p = v * 0.5 — every particle fell the same amount.
+        for particle in system.particles() {
+            assert!(particle.position.y < 0.0);
+            assert!(particle.velocity.y < 0.0);
+        }
+    }
+
+    #[test]
+    fn test_expired_particles_are_recycled() {
+        let mut system = ParticleSystem::new(ParticleSystemConfig {
+            emission_rate: 0.0,
+            lifetime: RandomRange::constant(1.0),
+            looping: false,
+            duration: 0.1,
+            ..Default::default()
+        });
+        system.burst(50);
+        assert_eq!(system.alive_count(), 50);
+
+        system.update(2.0); // past every particle's max lifetime
+        assert_eq!(system.alive_count(), 0);
+        assert!(system.is_finished());
+    }
+
+    #[test]
+    fn test_emission_respects_max_particles() {
+        let mut system = ParticleSystem::new(ParticleSystemConfig {
+            max_particles: 10,
+            lifetime: RandomRange::constant(100.0),
+            ..Default::default()
+        });
+        system.burst(1000);
+        assert_eq!(system.alive_count(), 10);
+    }
+}
@@ -1,3 +1,4 @@
+use crate::core::jobs;
 use crate::scene::transform::Transform;
 use glam::{Quat, Vec3};
 
@@ -258,11 +259,207 @@ impl Ray {
     }
 }
 
+// =============================================================================
+// Broadphase — incremental sweep-and-prune over body AABBs
+// =============================================================================
+
+/// Handle to a body proxy registered with the [`Broadphase`].
+pub type BroadphaseHandle = u32;
+
+/// Below this many proxies the pair sweep runs serially; rayon overhead
+/// dominates for small worlds.
+const BROADPHASE_PAR_THRESHOLD: usize = 256;
+
+/// Proxy snapshot used during the sweep. Carries its own position in the
+/// sorted order so parallel workers can scan forward without extra lookups.
+#[derive(Clone, Copy)]
+struct SweepEntry {
+    order: u32,
+    handle: BroadphaseHandle,
+    min: Vec3,
+    max: Vec3,
+}
+
+/// Incremental sweep-and-prune broadphase.
+///
+/// Proxies are kept sorted by `min.x`. Because bodies move coherently frame
+/// to frame, the list stays nearly sorted and the per-query insertion sort
+/// is close to O(n). Pair generation sweeps the sorted axis and only tests
+/// Y/Z overlap inside each X interval, turning the O(n²) all-pairs test into
+/// roughly O(n + k) for k overlaps.
+pub struct Broadphase {
+    /// Slot-addressed proxy AABBs; handles index this directly.
+    aabbs: Vec<AABB>,
+    alive: Vec<bool>,
+    free: Vec<BroadphaseHandle>,
+    /// Live handles ordered by `aabbs[h].min.x`.
+    sorted: Vec<BroadphaseHandle>,
+    sort_dirty: bool,
+}
+
+impl Broadphase {
+    pub fn new() -> Self {
+        Self {
+            aabbs: Vec::new(),
+            alive: Vec::new(),
+            free: Vec::new(),
+            sorted: Vec::new(),
+            sort_dirty: false,
+        }
+    }
+
+    /// Register a proxy and return its handle. Slots are recycled.
+    pub fn insert(&mut self, aabb: AABB) -> BroadphaseHandle {
+        let handle = if let Some(handle) = self.free.pop() {
+            self.aabbs[handle as usize] = aabb;
+            self.alive[handle as usize] = true;
+            handle
+        } else {
+            self.aabbs.push(aabb);
+            self.alive.push(true);
+            (self.aabbs.len() - 1) as BroadphaseHandle
+        };
+        self.sorted.push(handle);
+        self.sort_dirty = true;
+        handle
+    }
+
+    /// Move a proxy. Cheap: the sorted order is repaired lazily on the next
+    /// query, and coherent motion keeps that repair near-linear.
+    pub fn update(&mut self, handle: BroadphaseHandle, aabb: AABB) {
+        debug_assert!(self.alive[handle as usize]);
+        self.aabbs[handle as usize] = aabb;
+        self.sort_dirty = true;
+    }
+
+    pub fn remove(&mut self, handle: BroadphaseHandle) {
+        debug_assert!(self.alive[handle as usize]);
+        self.alive[handle as usize] = false;
+        self.free.push(handle);
+        if let Some(pos) = self.sorted.iter().position(|&h| h == handle) {
+            self.sorted.remove(pos);
+        }
+    }
+
+    pub fn aabb(&self, handle: BroadphaseHandle) -> &AABB {
+        &self.aabbs[handle as usize]
+    }
+
+    pub fn len(&self) -> usize {
+        self.sorted.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.sorted.is_empty()
+    }
+
+    /// Repair the sorted axis. Insertion sort: O(n) on the nearly-sorted
+    /// lists produced by frame-coherent motion.
+    fn sort(&mut self) {
+        if !self.sort_dirty {
+            return;
+        }
+        let aabbs = &self.aabbs;
+        let key = |h: BroadphaseHandle| aabbs[h as usize].min.x;
+        for i in 1..self.sorted.len() {
+            let h = self.sorted[i];
+            let k = key(h);
+            let mut j = i;
+            while j > 0 && key(self.sorted[j - 1]) > k {
+                self.sorted[j] = self.sorted[j - 1];
+                j -= 1;
+            }
+            self.sorted[j] = h;
+        }
+        self.sort_dirty = false;
+    }
+
+    fn sweep_entries(&self) -> Vec<SweepEntry> {
+        self.sorted
+            .iter()
+            .enumerate()
+            .map(|(order, &handle)| {
+                let aabb = &self.aabbs[handle as usize];
+                SweepEntry { order: order as u32, handle, min: aabb.min, max: aabb.max }
+            })
+            .collect()
+    }
+
+    /// Scan forward from `entry` along the sorted axis, testing Y/Z overlap
+    /// for every proxy whose X interval touches it.
+    fn sweep_from(entry: &SweepEntry, entries: &[SweepEntry], out: &mut Vec<(BroadphaseHandle, BroadphaseHandle)>) {
+        for other in &entries[entry.order as usize + 1..] {
+            if other.min.x > entry.max.x {
+                break;
+            }
+            if entry.min.y <= other.max.y
+                && entry.max.y >= other.min.y
+                && entry.min.z <= other.max.z
+                && entry.max.z >= other.min.z
+            {
+                out.push((entry.handle, other.handle));
+            }
+        }
+    }
+
+    /// All overlapping proxy pairs. Each pair is reported once, with the
+    /// handle that comes first on the sweep axis in `.0`. The per-entry
+    /// interval tests run through the job system for large worlds.
+    pub fn query_pairs(&mut self) -> Vec<(BroadphaseHandle, BroadphaseHandle)> {
+        self.sort();
+        let entries = self.sweep_entries();
+
+        if entries.len() < BROADPHASE_PAR_THRESHOLD {
+            let mut pairs = Vec::new();
+            for entry in &entries {
+                Self::sweep_from(entry, &entries, &mut pairs);
+            }
+            return pairs;
+        }
+
+        jobs::parallel_reduce(
+            &entries,
+            Vec::new,
+            |mut acc: Vec<(BroadphaseHandle, BroadphaseHandle)>, entry| {
+                Self::sweep_from(entry, &entries, &mut acc);
+                acc
+            },
+            |mut a, mut b| {
+                a.append(&mut b);
+                a
+            },
+        )
+    }
+
+    /// All proxies overlapping `aabb`. Walks the sweep axis and stops at the
+    /// first proxy starting past the query's right edge.
+    pub fn query_aabb(&mut self, aabb: &AABB, out: &mut Vec<BroadphaseHandle>) {
+        self.sort();
+        out.clear();
+        for &handle in &self.sorted {
+            let other = &self.aabbs[handle as usize];
+            if other.min.x > aabb.max.x {
+                break;
+            }
+            if other.intersects(aabb) {
+                out.push(handle);
+            }
+        }
+    }
+}
+
+impl Default for Broadphase {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
 /// Simple physics world
 pub struct PhysicsWorld {
     pub gravity: Vec3,
     pub fixed_timestep: f32,
     accumulator: f32,
+    broadphase: Broadphase,
 }
 
 impl PhysicsWorld {
@@ -271,9 +468,40 @@ impl PhysicsWorld {
             gravity: Vec3::new(0.0, -9.81, 0.0),
             fixed_timestep: 1.0 / 60.0,
             accumulator: 0.0,
+            broadphase: Broadphase::new(),
         }
     }
 
+    /// Register a body's world-space AABB with the broadphase.
+    pub fn add_body(&mut self, aabb: AABB) -> BroadphaseHandle {
+        self.broadphase.insert(aabb)
+    }
+
+    /// Refresh a body's AABB after integration. Call once per moved body
+    /// per fixed step.
+    pub fn update_body(&mut self, handle: BroadphaseHandle, aabb: AABB) {
+        self.broadphase.update(handle, aabb);
+    }
+
+    pub fn remove_body(&mut self, handle: BroadphaseHandle) {
+        self.broadphase.remove(handle);
+    }
+
+    /// Candidate collision pairs for this step. Broadphase-exact: every
+    /// returned pair's AABBs overlap, and no overlapping pair is missed.
+    pub fn query_pairs(&mut self) -> Vec<(BroadphaseHandle, BroadphaseHandle)> {
+        self.broadphase.query_pairs()
+    }
+
+    /// All registered bodies whose AABB overlaps `aabb`.
+    pub fn query_aabb(&mut self, aabb: &AABB, out: &mut Vec<BroadphaseHandle>) {
+        self.broadphase.query_aabb(aabb, out);
+    }
+
+    pub fn broadphase(&self) -> &Broadphase {
+        &self.broadphase
+    }
+
     pub fn step(&mut self, delta_time: f32) -> u32 {
         self.accumulator += delta_time;
         let mut steps = 0;
@@ -484,3 +712,83 @@ impl CharacterController {
 fn lerp(a: f32, b: f32, t: f32) -> f32 {
     a + (b - a) * t.clamp(0.0, 1.0)
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn unit_box(center: Vec3) -> AABB {
+        AABB::from_center_size(center, Vec3::splat(1.0))
+    }
+
+    fn brute_force_pairs(aabbs: &[(BroadphaseHandle, AABB)]) -> Vec<(u32, u32)> {
+        let mut pairs = Vec::new();
+        for i in 0..aabbs.len() {
+            for j in (i + 1)..aabbs.len() {
+                if aabbs[i].1.intersects(&aabbs[j].1) {
+                    let (a, b) = (aabbs[i].0, aabbs[j].0);
+                    pairs.push((a.min(b), a.max(b)));
+                }
+            }
+        }
+        pairs.sort_unstable();
+        pairs
+    }
+
+    #[test]
+    fn broadphase_pairs_match_brute_force() {
+        let mut bp = Broadphase::new();
+        let mut bodies = Vec::new();
+        // Deterministic pseudo-random scatter with enough density to overlap.
+        let mut seed = 0x12345u32;
+        let mut rand = move || {
+            seed = seed.wrapping_mul(1664525).wrapping_add(1013904223);
+            (seed >> 8) as f32 / (1 << 24) as f32
+        };
+        for _ in 0..200 {
+            let center = Vec3::new(rand() * 20.0, rand() * 20.0, rand() * 20.0);
+            let aabb = unit_box(center);
+            bodies.push((bp.insert(aabb), aabb));
+        }
+
+        let mut pairs: Vec<_> = bp
+            .query_pairs()
+            .into_iter()
+            .map(|(a, b)| (a.min(b), a.max(b)))
+            .collect();
+        pairs.sort_unstable();
+        assert_eq!(pairs, brute_force_pairs(&bodies));
+    }
+
+    #[test]
+    fn broadphase_tracks_updates_and_removals() {
+        let mut bp = Broadphase::new();
+        let a = bp.insert(unit_box(Vec3::ZERO));
+        let b = bp.insert(unit_box(Vec3::new(10.0, 0.0, 0.0)));
+        assert!(bp.query_pairs().is_empty());
+
+        // Move b on top of a → one pair.
+        bp.update(b, unit_box(Vec3::new(0.25, 0.0, 0.0)));
+        assert_eq!(bp.query_pairs().len(), 1);
+
+        bp.remove(a);
+        assert!(bp.query_pairs().is_empty());
+
+        // Freed slot gets recycled.
+        let c = bp.insert(unit_box(Vec3::ZERO));
+        assert_eq!(c, a);
+        assert_eq!(bp.len(), 2);
+    }
+
+    #[test]
+    fn broadphase_query_aabb() {
+        let mut bp = Broadphase::new();
+        for i in 0..10 {
+            bp.insert(unit_box(Vec3::new(i as f32 * 2.0, 0.0, 0.0)));
+        }
+        let mut hits = Vec::new();
+        bp.query_aabb(&AABB::new(Vec3::new(3.0, -1.0, -1.0), Vec3::new(7.0, 1.0, 1.0)), &mut hits);
+        // Only the boxes centred at x=4 and x=6 reach into [3, 7].
+        assert_eq!(hits.len(), 2);
+    }
+}